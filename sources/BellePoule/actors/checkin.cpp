@@ -488,6 +488,25 @@ namespace People
     return file_content;
   }
 
+  // --------------------------------------------------------------------------------
+  void Checkin::AddImported (GList *players)
+  {
+    // List change notifications are up to the caller
+    BatchAdditions (TRUE);
+    for (GList *current = players; current; current = g_list_next (current))
+    {
+      Player *player = (Player *) current->data;
+
+      OnPlayerLoaded (player,
+                      nullptr);
+      Add (player);
+      player->Release ();
+    }
+    BatchAdditions (FALSE);
+
+    g_list_free (players);
+  }
+
   // --------------------------------------------------------------------------------
   void Checkin::ConvertFromBaseToResult ()
   {
@@ -555,6 +574,8 @@ namespace People
           g_date_free (current_date);
         }
 
+        GList *imported = nullptr;
+
         // Header
         // FFF;WIN;CLASSEMENT;FFE
         // 08/11/2009;;;;
@@ -700,15 +721,15 @@ namespace People
           {
             if (player)
             {
-              OnPlayerLoaded (player, nullptr);
-              Add (player);
-              player->Release ();
+              imported = g_list_prepend (imported,
+                                         player);
             }
 
             g_strfreev (line);
           }
         }
 
+        AddImported (g_list_reverse (imported));
         g_strfreev (lines);
       }
       g_free (utf8_content);
@@ -764,6 +785,7 @@ namespace People
         guint           nb_attr    = 0;
         AttributeDesc **columns    = nullptr;
         const char     *delimiters = ",";
+        GList          *imported   = nullptr;
 
         if (strchr (rows[0], ';'))
         {
@@ -836,15 +858,19 @@ namespace People
 
             if (has_attribute)
             {
-              OnPlayerLoaded (player, nullptr);
-              Add (player);
+              imported = g_list_prepend (imported,
+                                         player);
+            }
+            else
+            {
+              player->Release ();
             }
-            player->Release ();
 
             g_strfreev (tokens);
           }
         }
 
+        AddImported (g_list_reverse (imported));
         g_free (columns);
       }
       g_strfreev (rows);
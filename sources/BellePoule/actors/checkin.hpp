@@ -148,6 +148,8 @@ namespace People
 
       gchar *GetFileContent (const gchar *filename);
 
+      void AddImported (GList *players);
+
       gchar *GetPrintName () override;
 
       void GuessPlayerOrganization (Player      *player,
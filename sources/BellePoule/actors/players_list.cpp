@@ -43,7 +43,10 @@ namespace People
     _selector_column    = -1;
     _parcel_name        = nullptr;
     _list_changes_muted = FALSE;
+    _batching           = FALSE;
+    _batch_tail         = nullptr;
     _anti_cheat_block   = anti_cheat_block;
+    _ref_index          = nullptr;
 
     {
       _tree_view = GTK_TREE_VIEW (_glade->GetWidget ("players_list"));
@@ -333,23 +336,59 @@ namespace People
   {
     if (ref)
     {
-      GList *current = _player_list;
+      Player *player;
 
-      while (current)
+      if (_ref_index == nullptr)
       {
-        Player *player = (Player *) current->data;
+        _ref_index = g_hash_table_new (nullptr,
+                                       nullptr);
+
+        for (GList *current = _player_list; current; current = g_list_next (current))
+        {
+          gpointer key = GUINT_TO_POINTER (((Player *) current->data)->GetRef ());
+
+          if (g_hash_table_lookup (_ref_index, key) == nullptr)
+          {
+            g_hash_table_insert (_ref_index,
+                                 key,
+                                 current->data);
+          }
+        }
+      }
+
+      player = (Player *) g_hash_table_lookup (_ref_index,
+                                               GUINT_TO_POINTER (ref));
+      if (player && (player->GetRef () == ref))
+      {
+        return player;
+      }
+
+      // Refs can be changed behind our back (renumbering, merge...)
+      for (GList *current = _player_list; current; current = g_list_next (current))
+      {
+        player = (Player *) current->data;
 
         if (player->GetRef () == ref)
         {
+          DropRefIndex ();
           return player;
         }
-        current = g_list_next (current);
       }
     }
 
     return nullptr;
   }
 
+  // --------------------------------------------------------------------------------
+  void PlayersList::DropRefIndex ()
+  {
+    if (_ref_index)
+    {
+      g_hash_table_destroy (_ref_index);
+      _ref_index = nullptr;
+    }
+  }
+
   // --------------------------------------------------------------------------------
   void PlayersList::Update (Player *player)
   {
@@ -429,13 +468,13 @@ namespace People
 
       if (filter (p, owner) == TRUE)
       {
-        custom_list = g_slist_append (custom_list,
-                                      p);
+        custom_list = g_slist_prepend (custom_list,
+                                       p);
       }
       current = g_list_next (current);
     }
 
-    return custom_list;
+    return g_slist_reverse (custom_list);
   }
 
   // --------------------------------------------------------------------------------
@@ -837,8 +876,31 @@ namespace People
 
     _store->Append (player);
 
-    _player_list = g_list_append (_player_list,
-                                  player);
+    // While batching, players are linked after the last one
+    // instead of walking the whole list for each of them.
+    if (_batch_tail)
+    {
+      _batch_tail = g_list_next (g_list_append (_batch_tail,
+                                                player));
+    }
+    else
+    {
+      _player_list = g_list_append (_player_list,
+                                    player);
+
+      if (_batching)
+      {
+        _batch_tail = g_list_last (_player_list);
+      }
+    }
+
+    if (   _ref_index
+        && (g_hash_table_lookup (_ref_index, GUINT_TO_POINTER (player->GetRef ())) == nullptr))
+    {
+      g_hash_table_insert (_ref_index,
+                           GUINT_TO_POINTER (player->GetRef ()),
+                           player);
+    }
 
     if (_parcel_name)
     {
@@ -866,6 +928,8 @@ namespace People
 
     g_list_free (_player_list);
     _player_list = nullptr;
+    _batch_tail  = nullptr;
+    DropRefIndex ();
 
     if (_store)
     {
@@ -1008,6 +1072,8 @@ namespace People
 
       _player_list = g_list_remove (_player_list,
                                     player);
+      _batch_tail  = nullptr;
+      DropRefIndex ();
 
       player->Release ();
 
@@ -1033,6 +1099,18 @@ namespace People
     _list_changes_muted = mute;
   }
 
+  // --------------------------------------------------------------------------------
+  void PlayersList::BatchAdditions (gboolean batch)
+  {
+    _batching   = batch;
+    _batch_tail = nullptr;
+
+    if (_batching)
+    {
+      _batch_tail = g_list_last (_player_list);
+    }
+  }
+
   // --------------------------------------------------------------------------------
   void PlayersList::NotifyListChanged ()
   {
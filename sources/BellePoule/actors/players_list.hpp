@@ -125,6 +125,8 @@ namespace People
 
       void NotifyListChanged ();
 
+      void BatchAdditions (gboolean batch);
+
       virtual void OnListChanged ();
 
       Player *GetPlayerWithAttribute (Player::AttributeId *attr_id,
@@ -157,7 +159,12 @@ namespace People
       PlayersStore   *_store;
       const gchar    *_parcel_name;
       gboolean        _list_changes_muted;
+      gboolean        _batching;
+      GList          *_batch_tail;
       AntiCheatBlock *_anti_cheat_block;
+      GHashTable     *_ref_index;
+
+      void DropRefIndex ();
 
       void RefreshDisplay ();
 
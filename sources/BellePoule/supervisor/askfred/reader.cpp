@@ -15,8 +15,7 @@
 //   along with BellePoule.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <libxml/parser.h>
-#include <libxml/xpath.h>
-#include <libxml/xpathInternals.h>
+#include <libxml/xmlreader.h>
 
 #include "util/player.hpp"
 #include "actors/player_factory.hpp"
@@ -57,7 +56,9 @@ namespace AskFred
       _gender        = nullptr;
       _licence       = nullptr;
       _club          = nullptr;
+      _club_id       = 0;
       _members       = nullptr;
+      _member_ids    = nullptr;
 
       _rating_saber  = nullptr;
       _rating_epee   = nullptr;
@@ -76,6 +77,7 @@ namespace AskFred
       g_free (_birth);
       g_free (_gender);
       g_list_free (_members);
+      g_list_free (_member_ids);
       g_free (_licence);
       g_free (_rating_saber);
       g_free (_rating_epee);
@@ -280,7 +282,8 @@ namespace AskFred
       _category   = nullptr;
       _team_event = FALSE;
 
-      _competitors = nullptr;
+      _competitors    = nullptr;
+      _competitor_ids = nullptr;
     }
 
     // --------------------------------------------------------------------------------
@@ -292,6 +295,7 @@ namespace AskFred
       g_free (_event_id);
 
       g_list_free (_competitors);
+      g_list_free (_competitor_ids);
     }
   }
 
@@ -309,6 +313,7 @@ namespace AskFred
       _tournament_id = nullptr;
 
       _events = nullptr;
+      _error  = nullptr;
 
       _competitors = g_hash_table_new_full (g_direct_hash,
                                             g_direct_equal,
@@ -410,33 +415,7 @@ namespace AskFred
         g_hash_table_insert (_divisions, GINT_TO_POINTER (81),  (gpointer) "Newfoundland");
       }
 
-      {
-        xmlDoc *doc = xmlParseFile (filename);
-
-        if (doc)
-        {
-          xmlXPathInit ();
-
-          {
-            xmlXPathContext *context = xmlXPathNewContext (doc);
-
-            xmlXPathRegisterNs (context, BAD_CAST "fred", BAD_CAST "http://www.askfred.net");
-
-            if (CheckData (context))
-            {
-              LoadTournament  (context);
-              LoadClubs       (context);
-              LoadCompetitors (context);
-              LoadTeams       (context);
-              LoadEvents      (context);
-            }
-
-            xmlXPathFreeContext (context);
-          }
-
-          xmlFreeDoc (doc);
-        }
-      }
+      Read (filename);
     }
 
     // --------------------------------------------------------------------------------
@@ -451,6 +430,7 @@ namespace AskFred
       g_free (_location);
       g_free (_organizer);
       g_free (_tournament_id);
+      g_free (_error);
     }
 
     // --------------------------------------------------------------------------------
@@ -460,485 +440,579 @@ namespace AskFred
     }
 
     // --------------------------------------------------------------------------------
-    gboolean Parser::CheckData (xmlXPathContext *context )
+    const gchar *Parser::GetError ()
+    {
+      return _error;
+    }
+
+    // --------------------------------------------------------------------------------
+    void Parser::Read (const gchar *filename)
     {
-      gboolean        result     = FALSE;
-      xmlXPathObject *xml_object = xmlXPathEval (BAD_CAST "/fred:FencingData",
-                                                 context);
+      xmlTextReader *reader;
+
+      xmlResetLastError ();
+      reader = xmlReaderForFile (filename,
+                                 nullptr,
+                                 0);
 
-      if (xml_object->nodesetval)
+      if (reader)
       {
-        if (xml_object->nodesetval->nodeNr == 1)
-        {
-          gchar      *attr;
-          xmlNodeSet *xml_nodeset = xml_object->nodesetval;
+        gchar *section = nullptr;
+        gint   status  = xmlTextReaderRead (reader);
 
-          attr = (gchar *) xmlGetProp (xml_nodeset->nodeTab[0], BAD_CAST "Context");
-          if (attr)
+        // Only one record (club, fencer, team or event) is expanded at a
+        // time. The reader drops each one once it has moved past it.
+        while (status == 1)
+        {
+          if (xmlTextReaderNodeType (reader) == XML_READER_TYPE_ELEMENT)
           {
-            if (g_strcmp0 (attr, "PreReg") == 0)
+            const gchar *name  = (const gchar *) xmlTextReaderConstLocalName (reader);
+            gint         depth = xmlTextReaderDepth (reader);
+
+            if (depth == 0)
             {
-              result = TRUE;
+              if (CheckData (xmlTextReaderCurrentNode (reader)) == FALSE)
+              {
+                break;
+              }
+            }
+            else if (depth == 1)
+            {
+              g_free (section);
+              section = g_strdup (name);
+
+              if (g_strcmp0 (name, "Tournament") == 0)
+              {
+                LoadTournament (xmlTextReaderCurrentNode (reader));
+              }
+            }
+            else if (depth == 2)
+            {
+              xmlNode *record = xmlTextReaderExpand (reader);
+
+              if (record == nullptr)
+              {
+                status = -1;
+                break;
+              }
+
+              if (   (g_strcmp0 (section, "ClubDatabase") == 0)
+                  && (g_strcmp0 (name,    "Club")         == 0))
+              {
+                LoadClub (record);
+              }
+              else if (   (g_strcmp0 (section, "FencerDatabase") == 0)
+                       && (g_strcmp0 (name,    "Fencer")         == 0))
+              {
+                LoadCompetitor (record);
+              }
+              else if (   (g_strcmp0 (section, "TeamDatabase") == 0)
+                       && (g_strcmp0 (name,    "Team")         == 0))
+              {
+                LoadTeam (record);
+              }
+              else if (   (g_strcmp0 (section, "Tournament") == 0)
+                       && (g_strcmp0 (name,    "Event")      == 0))
+              {
+                LoadEvent (record);
+              }
+
+              status = xmlTextReaderNext (reader);
+              continue;
             }
-            xmlFree (attr);
           }
+
+          status = xmlTextReaderRead (reader);
         }
-      }
-      xmlXPathFreeObject  (xml_object);
 
-      return result;
-    }
+        g_free (section);
+        xmlFreeTextReader (reader);
 
-    // --------------------------------------------------------------------------------
-    void Parser::LoadTournament (xmlXPathContext *context)
-    {
-      xmlXPathObject *xml_object = xmlXPathEval (BAD_CAST "/fred:FencingData/fred:Tournament",
-                                                 context);
-
-      if (xml_object->nodesetval)
-      {
-        for (gint i = 0; i < xml_object->nodesetval->nodeNr; i++)
+        // A damaged file imports nothing rather than a part of it
+        if (status < 0)
         {
-          gchar      *attr;
-          xmlNodeSet *xml_nodeset = xml_object->nodesetval;
+          const xmlError *error = xmlGetLastError ();
 
-          attr = (gchar *) xmlGetProp (xml_nodeset->nodeTab[i], BAD_CAST "Name");
-          if (attr)
+          if (error && error->message)
           {
-            _name = g_strndup (attr, 30);
-            if (strlen (attr) > 30)
-            {
-              g_strlcpy (&_name[27],
-                         "...",
-                         4);
-            }
+            gchar *message = g_strdup (error->message);
 
-            xmlFree (attr);
+            _error = g_strdup_printf ("%s (line %d)",
+                                      g_strstrip (message),
+                                      error->line);
+            g_free (message);
           }
-
-          attr = (gchar *) xmlGetProp (xml_nodeset->nodeTab[i], BAD_CAST "TournamentID");
-          if (attr)
+          else
           {
-            _tournament_id = g_strdup (attr);
-            xmlFree (attr);
+            _error = g_strdup ("Malformed file");
           }
 
-          attr = (gchar *) xmlGetProp (xml_nodeset->nodeTab[i], BAD_CAST "Org");
-          if (attr)
-          {
-            _organizer = g_strdup (attr);
-            xmlFree (attr);
-          }
+          FreeFullGList (Event, _events);
+          g_hash_table_remove_all (_competitors);
+          g_hash_table_remove_all (_clubs);
+        }
+        else
+        {
+          ResolveReferences ();
+        }
+      }
+      else
+      {
+        _error = g_strdup_printf ("Unable to open %s", filename);
+      }
+    }
 
-          attr = (gchar *) xmlGetProp (xml_nodeset->nodeTab[i], BAD_CAST "Location");
-          if (attr)
+    // --------------------------------------------------------------------------------
+    void Parser::ResolveReferences ()
+    {
+      // The databases may come in any order, links are made once all are read
+      {
+        GHashTableIter  iter;
+        Competitor     *competitor;
+
+        g_hash_table_iter_init (&iter,
+                                _competitors);
+        while (g_hash_table_iter_next (&iter,
+                                       nullptr,
+                                       (gpointer *) &competitor))
+        {
+          if (competitor->_club_id)
           {
-            _location = g_strdup (attr);
-            xmlFree (attr);
+            competitor->_club = (Club *) g_hash_table_lookup (_clubs,
+                                                              GINT_TO_POINTER (competitor->_club_id));
           }
+
+          competitor->_members    = Resolve (competitor->_member_ids);
+          competitor->_member_ids = nullptr;
         }
       }
 
-      xmlXPathFreeObject  (xml_object);
+      for (GList *current = _events; current; current = g_list_next (current))
+      {
+        Event *event = (Event *) current->data;
+
+        event->_competitors    = Resolve (event->_competitor_ids);
+        event->_competitor_ids = nullptr;
+      }
     }
 
     // --------------------------------------------------------------------------------
-    void Parser::LoadCompetitors (xmlXPathContext *context)
+    GList *Parser::Resolve (GList *ids)
     {
-      xmlXPathObject *xml_object = xmlXPathEval (BAD_CAST "/fred:FencingData/fred:FencerDatabase/fred:Fencer",
-                                                 context);
+      GList *resolved = nullptr;
 
-      if (xml_object->nodesetval)
+      for (GList *current = ids; current; current = g_list_next (current))
       {
-        for (gint i = 0; i < xml_object->nodesetval->nodeNr; i++)
+        Competitor *competitor = (Competitor *) g_hash_table_lookup (_competitors,
+                                                                     current->data);
+
+        if (competitor)
         {
-          gchar      *attr;
-          xmlNodeSet *xml_nodeset = xml_object->nodesetval;
-          Competitor *competitor = new Competitor ();
+          resolved = g_list_prepend (resolved,
+                                     competitor);
+        }
+      }
 
-          attr = (gchar *) xmlGetProp (xml_nodeset->nodeTab[i], BAD_CAST "FencerID");
-          if (attr)
-          {
-            competitor->_competitor_id = g_strdup (attr);
+      g_list_free (ids);
 
-            g_hash_table_insert (_competitors,
-                                 GINT_TO_POINTER (g_ascii_strtoll (attr, nullptr, 10)),
-                                 competitor);
+      return g_list_reverse (resolved);
+    }
 
-            xmlFree (attr);
-          }
+    // --------------------------------------------------------------------------------
+    gboolean Parser::CheckData (xmlNode *xml_node)
+    {
+      gboolean result = FALSE;
 
-          attr = (gchar *) xmlGetProp (xml_nodeset->nodeTab[i], BAD_CAST "LastName");
-          if (attr)
-          {
-            competitor->_last_name = g_strdup (attr);
-            xmlFree (attr);
-          }
+      if (xml_node && (g_strcmp0 ((gchar *) xml_node->name, "FencingData") == 0))
+      {
+        gchar *attr = (gchar *) xmlGetProp (xml_node, BAD_CAST "Context");
 
-          attr = (gchar *) xmlGetProp (xml_nodeset->nodeTab[i], BAD_CAST "FirstName");
-          if (attr)
+        if (attr)
+        {
+          if (g_strcmp0 (attr, "PreReg") == 0)
           {
-            competitor->_first_name = g_strdup (attr);
-            xmlFree (attr);
+            result = TRUE;
           }
+          xmlFree (attr);
+        }
+      }
 
-          attr = (gchar *) xmlGetProp (xml_nodeset->nodeTab[i], BAD_CAST "Gender");
-          if (attr)
-          {
-            competitor->_gender = g_strdup (attr);
-            xmlFree (attr);
-          }
+      return result;
+    }
 
-          attr = (gchar *) xmlGetProp (xml_nodeset->nodeTab[i], BAD_CAST "BirthYear");
-          if (attr)
-          {
-            competitor->_birth = g_strdup (attr);
-            xmlFree (attr);
-          }
+    // --------------------------------------------------------------------------------
+    void Parser::LoadTournament (xmlNode *xml_node)
+    {
+      gchar *attr;
 
-          attr = (gchar *) xmlGetProp (xml_nodeset->nodeTab[i], BAD_CAST "ClubID1");
-          if (attr)
-          {
-            guint  id   = g_ascii_strtoll (attr, nullptr, 10);
-            Club  *club;
+      attr = (gchar *) xmlGetProp (xml_node, BAD_CAST "Name");
+      if (attr)
+      {
+        _name = g_strndup (attr, 30);
+        if (strlen (attr) > 30)
+        {
+          g_strlcpy (&_name[27],
+                     "...",
+                     4);
+        }
 
-            club = (Club *) g_hash_table_lookup (_clubs,
-                                                 GINT_TO_POINTER (id));
-            competitor->_club = club;
+        xmlFree (attr);
+      }
 
-            xmlFree (attr);
-          }
+      attr = (gchar *) xmlGetProp (xml_node, BAD_CAST "TournamentID");
+      if (attr)
+      {
+        _tournament_id = g_strdup (attr);
+        xmlFree (attr);
+      }
 
-          for (xmlNode *n = xml_nodeset->nodeTab[i]->children; n != nullptr; n = n->next)
-          {
-            if (n->type == XML_ELEMENT_NODE)
-            {
-              if (g_strcmp0 ((gchar *)n->name, "Membership") == 0)
-              {
-                if (n->children && (n->children->type == XML_TEXT_NODE))
-                {
-                  competitor->_licence = g_strdup ((gchar *) n->children->content);
-                }
-              }
-              else if (g_strcmp0 ((gchar *)n->name, "Rating") == 0)
-              {
-                attr = (gchar *) xmlGetProp (n, BAD_CAST "Weapon");
-                if (attr)
-                {
-                  if (n->children && (n->children->type == XML_TEXT_NODE))
-                  {
-                    competitor->SetRanking (attr,
-                                            (gchar *) n->children->content);
-                  }
-                  xmlFree (attr);
-                }
-              }
-            }
-          }
-        }
+      attr = (gchar *) xmlGetProp (xml_node, BAD_CAST "Org");
+      if (attr)
+      {
+        _organizer = g_strdup (attr);
+        xmlFree (attr);
       }
 
-      xmlXPathFreeObject  (xml_object);
+      attr = (gchar *) xmlGetProp (xml_node, BAD_CAST "Location");
+      if (attr)
+      {
+        _location = g_strdup (attr);
+        xmlFree (attr);
+      }
     }
 
     // --------------------------------------------------------------------------------
-    void Parser::LoadTeams (xmlXPathContext *context)
+    void Parser::LoadCompetitor (xmlNode *xml_node)
     {
-      xmlXPathObject *xml_object = xmlXPathEval (BAD_CAST "/fred:FencingData/fred:TeamDatabase/fred:Team",
-                                                 context);
+      gchar      *attr;
+      Competitor *competitor = new Competitor ();
 
-      if (xml_object->nodesetval)
+      attr = (gchar *) xmlGetProp (xml_node, BAD_CAST "FencerID");
+      if (attr)
       {
-        for (gint i = 0; i < xml_object->nodesetval->nodeNr; i++)
-        {
-          gchar      *attr;
-          xmlNodeSet *xml_nodeset = xml_object->nodesetval;
-          Competitor *competitor = new Competitor ();
+        competitor->_competitor_id = g_strdup (attr);
 
-          attr = (gchar *) xmlGetProp (xml_nodeset->nodeTab[i], BAD_CAST "TeamID");
-          if (attr)
-          {
-            competitor->_competitor_id = g_strdup (attr);
+        g_hash_table_insert (_competitors,
+                             GINT_TO_POINTER (g_ascii_strtoll (attr, nullptr, 10)),
+                             competitor);
 
-            g_hash_table_insert (_competitors,
-                                 GINT_TO_POINTER (g_ascii_strtoll (attr, nullptr, 10)),
-                                 competitor);
+        xmlFree (attr);
+      }
 
-            xmlFree (attr);
-          }
+      attr = (gchar *) xmlGetProp (xml_node, BAD_CAST "LastName");
+      if (attr)
+      {
+        competitor->_last_name = g_strdup (attr);
+        xmlFree (attr);
+      }
 
-          attr = (gchar *) xmlGetProp (xml_nodeset->nodeTab[i], BAD_CAST "Name");
-          if (attr)
-          {
-            competitor->_last_name = g_strdup (attr);
-            xmlFree (attr);
-          }
+      attr = (gchar *) xmlGetProp (xml_node, BAD_CAST "FirstName");
+      if (attr)
+      {
+        competitor->_first_name = g_strdup (attr);
+        xmlFree (attr);
+      }
 
-          attr = (gchar *) xmlGetProp (xml_nodeset->nodeTab[i], BAD_CAST "ClubID");
-          if (attr)
-          {
-            guint  id   = g_ascii_strtoll (attr, nullptr, 10);
-            Club  *club;
+      attr = (gchar *) xmlGetProp (xml_node, BAD_CAST "Gender");
+      if (attr)
+      {
+        competitor->_gender = g_strdup (attr);
+        xmlFree (attr);
+      }
 
-            club = (Club *) g_hash_table_lookup (_clubs,
-                                                 GINT_TO_POINTER (id));
-            competitor->_club = club;
+      attr = (gchar *) xmlGetProp (xml_node, BAD_CAST "BirthYear");
+      if (attr)
+      {
+        competitor->_birth = g_strdup (attr);
+        xmlFree (attr);
+      }
 
-            xmlFree (attr);
-          }
+      attr = (gchar *) xmlGetProp (xml_node, BAD_CAST "ClubID1");
+      if (attr)
+      {
+        competitor->_club_id = g_ascii_strtoll (attr, nullptr, 10);
+        xmlFree (attr);
+      }
 
-          for (xmlNode *n = xml_nodeset->nodeTab[i]->children; n != nullptr; n = n->next)
+      for (xmlNode *n = xml_node->children; n != nullptr; n = n->next)
+      {
+        if (n->type == XML_ELEMENT_NODE)
+        {
+          if (g_strcmp0 ((gchar *)n->name, "Membership") == 0)
+          {
+            if (n->children && (n->children->type == XML_TEXT_NODE))
+            {
+              competitor->_licence = g_strdup ((gchar *) n->children->content);
+            }
+          }
+          else if (g_strcmp0 ((gchar *)n->name, "Rating") == 0)
           {
-            if (n->type == XML_ELEMENT_NODE)
+            attr = (gchar *) xmlGetProp (n, BAD_CAST "Weapon");
+            if (attr)
             {
-              if (g_strcmp0 ((gchar *)n->name, "Fencer") == 0)
+              if (n->children && (n->children->type == XML_TEXT_NODE))
               {
-                attr = (gchar *) xmlGetProp (n, BAD_CAST "FencerID");
-                if (attr)
-                {
-                  guint       id     = g_ascii_strtoll (attr, nullptr, 10);
-                  Competitor *member = (Competitor *) g_hash_table_lookup (_competitors,
-                                                                           GINT_TO_POINTER (id));
-
-                  competitor->_members = g_list_prepend (competitor->_members,
-                                                         member);
-                  xmlFree (attr);
-                }
+                competitor->SetRanking (attr,
+                                        (gchar *) n->children->content);
               }
+              xmlFree (attr);
             }
           }
         }
       }
-
-      xmlXPathFreeObject  (xml_object);
     }
 
     // --------------------------------------------------------------------------------
-    void Parser::LoadClubs (xmlXPathContext *context)
+    void Parser::LoadTeam (xmlNode *xml_node)
     {
-      xmlXPathObject *xml_object = xmlXPathEval (BAD_CAST "/fred:FencingData/fred:ClubDatabase/fred:Club",
-                                                 context);
+      gchar      *attr;
+      Competitor *competitor = new Competitor ();
 
-      if (xml_object->nodesetval)
+      attr = (gchar *) xmlGetProp (xml_node, BAD_CAST "TeamID");
+      if (attr)
       {
-        for (gint i = 0; i < xml_object->nodesetval->nodeNr; i++)
-        {
-          gchar      *attr;
-          xmlNodeSet *xml_nodeset = xml_object->nodesetval;
-          Club       *club = new Club ();
+        competitor->_competitor_id = g_strdup (attr);
 
-          attr = (gchar *) xmlGetProp (xml_nodeset->nodeTab[i], BAD_CAST "Abbreviation");
-          if (attr)
-          {
-            club->_name = g_strdup (attr);
-            xmlFree (attr);
-          }
+        g_hash_table_insert (_competitors,
+                             GINT_TO_POINTER (g_ascii_strtoll (attr, nullptr, 10)),
+                             competitor);
 
-          attr = (gchar *) xmlGetProp (xml_nodeset->nodeTab[i], BAD_CAST "DivisionID");
-          if (attr)
-          {
-            guint id = g_ascii_strtoll (attr, nullptr, 10);
+        xmlFree (attr);
+      }
 
-            club->_division = g_strdup ((const gchar *) g_hash_table_lookup (_divisions,
-                                                                             GINT_TO_POINTER (id)));
-            xmlFree (attr);
-          }
+      attr = (gchar *) xmlGetProp (xml_node, BAD_CAST "Name");
+      if (attr)
+      {
+        competitor->_last_name = g_strdup (attr);
+        xmlFree (attr);
+      }
 
-          attr = (gchar *) xmlGetProp (xml_nodeset->nodeTab[i], BAD_CAST "ClubID");
-          if (attr)
+      attr = (gchar *) xmlGetProp (xml_node, BAD_CAST "ClubID");
+      if (attr)
+      {
+        competitor->_club_id = g_ascii_strtoll (attr, nullptr, 10);
+        xmlFree (attr);
+      }
+
+      for (xmlNode *n = xml_node->children; n != nullptr; n = n->next)
+      {
+        if (n->type == XML_ELEMENT_NODE)
+        {
+          if (g_strcmp0 ((gchar *)n->name, "Fencer") == 0)
           {
-            g_hash_table_insert (_clubs,
-                                 GINT_TO_POINTER (g_ascii_strtoll (attr, nullptr, 10)),
-                                 club);
-            xmlFree (attr);
+            attr = (gchar *) xmlGetProp (n, BAD_CAST "FencerID");
+            if (attr)
+            {
+              guint id = g_ascii_strtoll (attr, nullptr, 10);
+
+              competitor->_member_ids = g_list_prepend (competitor->_member_ids,
+                                                        GINT_TO_POINTER (id));
+              xmlFree (attr);
+            }
           }
         }
       }
+    }
+
+    // --------------------------------------------------------------------------------
+    void Parser::LoadClub (xmlNode *xml_node)
+    {
+      gchar *attr;
+      Club  *club = new Club ();
+
+      attr = (gchar *) xmlGetProp (xml_node, BAD_CAST "Abbreviation");
+      if (attr)
+      {
+        club->_name = g_strdup (attr);
+        xmlFree (attr);
+      }
+
+      attr = (gchar *) xmlGetProp (xml_node, BAD_CAST "DivisionID");
+      if (attr)
+      {
+        guint id = g_ascii_strtoll (attr, nullptr, 10);
+
+        club->_division = g_strdup ((const gchar *) g_hash_table_lookup (_divisions,
+                                                                         GINT_TO_POINTER (id)));
+        xmlFree (attr);
+      }
 
-      xmlXPathFreeObject (xml_object);
+      attr = (gchar *) xmlGetProp (xml_node, BAD_CAST "ClubID");
+      if (attr)
+      {
+        g_hash_table_insert (_clubs,
+                             GINT_TO_POINTER (g_ascii_strtoll (attr, nullptr, 10)),
+                             club);
+        xmlFree (attr);
+      }
     }
 
     // --------------------------------------------------------------------------------
-    void Parser::LoadEvents (xmlXPathContext *context)
+    void Parser::LoadEvent (xmlNode *xml_node)
     {
-      xmlXPathObject *xml_object = xmlXPathEval (BAD_CAST "/fred:FencingData/fred:Tournament/fred:Event",
-                                                 context);
+      gchar *attr;
+      Event *event = new Event (_name,
+                                _location,
+                                _organizer,
+                                _tournament_id);
+
+      // Gender
+      attr = (gchar *) xmlGetProp (xml_node, BAD_CAST "EventID");
+      if (attr)
+      {
+        event->_event_id = g_strdup (attr);
+        xmlFree (attr);
+      }
 
-      if (xml_object->nodesetval)
+      // Gender
+      attr = (gchar *) xmlGetProp (xml_node, BAD_CAST "Gender");
+      if (attr)
       {
-        for (gint i = 0; i < xml_object->nodesetval->nodeNr; i++)
+        if (g_strcmp0 (attr, "Women") == 0)
+        {
+          event->_gender = g_strdup ("F");
+        }
+        else if (g_strcmp0 (attr, "Men") == 0)
         {
-          gchar      *attr;
-          xmlNodeSet *xml_nodeset = xml_object->nodesetval;
-          Event      *event       = new Event (_name,
-                                               _location,
-                                               _organizer,
-                                               _tournament_id);
+          event->_gender = g_strdup ("M");
+        }
+        else
+        {
+          event->_gender = g_strdup ("FM");
+        }
 
-          // Gender
-          attr = (gchar *) xmlGetProp (xml_nodeset->nodeTab[i], BAD_CAST "EventID");
-          if (attr)
-          {
-            event->_event_id = g_strdup (attr);
-            xmlFree (attr);
-          }
+        xmlFree (attr);
+      }
 
-          // Gender
-          attr = (gchar *) xmlGetProp (xml_nodeset->nodeTab[i], BAD_CAST "Gender");
-          if (attr)
-          {
-            if (g_strcmp0 (attr, "Women") == 0)
-            {
-              event->_gender = g_strdup ("F");
-            }
-            else if (g_strcmp0 (attr, "Men") == 0)
-            {
-              event->_gender = g_strdup ("M");
-            }
-            else
-            {
-              event->_gender = g_strdup ("FM");
-            }
+      // Weapon
+      attr = (gchar *) xmlGetProp (xml_node, BAD_CAST "Weapon");
+      if (attr)
+      {
+        if (g_strcmp0 (attr, "Epee") == 0)
+        {
+          event->_weapon = g_strdup ("E");
+        }
+        else if (g_strcmp0 (attr, "Foil") == 0)
+        {
+          event->_weapon = g_strdup ("F");
+        }
+        else
+        {
+          event->_weapon = g_strdup ("S");
+        }
 
-            xmlFree (attr);
-          }
+        xmlFree (attr);
+      }
 
-          // Weapon
-          attr = (gchar *) xmlGetProp (xml_nodeset->nodeTab[i], BAD_CAST "Weapon");
-          if (attr)
-          {
-            if (g_strcmp0 (attr, "Epee") == 0)
-            {
-              event->_weapon = g_strdup ("E");
-            }
-            else if (g_strcmp0 (attr, "Foil") == 0)
-            {
-              event->_weapon = g_strdup ("F");
-            }
-            else
-            {
-              event->_weapon = g_strdup ("S");
-            }
+      // Is team event
+      attr = (gchar *) xmlGetProp (xml_node, BAD_CAST "IsTeam");
+      if (attr)
+      {
+        event->_team_event = (g_strcmp0 (attr, "True") == 0);
 
-            xmlFree (attr);
-          }
+        xmlFree (attr);
+      }
 
-          // Is team event
-          attr = (gchar *) xmlGetProp (xml_nodeset->nodeTab[i], BAD_CAST "IsTeam");
-          if (attr)
-          {
-            event->_team_event = (g_strcmp0 (attr, "True") == 0);
+      // AgeLimitMax
+      attr = (gchar *) xmlGetProp (xml_node, BAD_CAST "AgeLimitMax");
+      if (attr)
+      {
+        if (g_strcmp0 (attr, "Y8") == 0)
+        {
+          event->_category = g_strdup ("M9");
+        }
+        else if (g_strcmp0 (attr, "Y10") == 0)
+        {
+          event->_category = g_strdup ("M11");
+        }
+        else if (g_strcmp0 (attr, "Y12") == 0)
+        {
+          event->_category = g_strdup ("M14");
+        }
+        else if (g_strcmp0 (attr, "Y14") == 0)
+        {
+          event->_category = g_strdup ("M14");
+        }
+        else if (g_strcmp0 (attr, "Cadet") == 0)
+        {
+          event->_category = g_strdup ("M17");
+        }
+        else if (g_strcmp0 (attr, "Junior") == 0)
+        {
+          event->_category = g_strdup ("M20");
+        }
+        else if (g_strcmp0 (attr, "Senior") == 0)
+        {
+          event->_category = g_strdup ("S");
+        }
+        else if (g_strcmp0 (attr, "Vet40") == 0)
+        {
+          event->_category = g_strdup ("V1");
+        }
+        else if (g_strcmp0 (attr, "Vet50") == 0)
+        {
+          event->_category = g_strdup ("V2");
+        }
+        else if (g_strcmp0 (attr, "Vet60") == 0)
+        {
+          event->_category = g_strdup ("V3");
+        }
+        else if (g_strcmp0 (attr, "Vet70") == 0)
+        {
+          event->_category = g_strdup ("V4");
+        }
+        else if (g_strcmp0 (attr, "VetCombined") == 0)
+        {
+          event->_category = g_strdup ("VET");
+        }
+        else
+        {
+          event->_category = g_strdup ("S");
+        }
 
-            xmlFree (attr);
-          }
+        xmlFree (attr);
+      }
 
-          // AgeLimitMax
-          attr = (gchar *) xmlGetProp (xml_nodeset->nodeTab[i], BAD_CAST "AgeLimitMax");
-          if (attr)
-          {
-            if (g_strcmp0 (attr, "Y8") == 0)
-            {
-              event->_category = g_strdup ("M9");
-            }
-            else if (g_strcmp0 (attr, "Y10") == 0)
-            {
-              event->_category = g_strdup ("M11");
-            }
-            else if (g_strcmp0 (attr, "Y12") == 0)
-            {
-              event->_category = g_strdup ("M14");
-            }
-            else if (g_strcmp0 (attr, "Y14") == 0)
-            {
-              event->_category = g_strdup ("M14");
-            }
-            else if (g_strcmp0 (attr, "Cadet") == 0)
-            {
-              event->_category = g_strdup ("M17");
-            }
-            else if (g_strcmp0 (attr, "Junior") == 0)
-            {
-              event->_category = g_strdup ("M20");
-            }
-            else if (g_strcmp0 (attr, "Senior") == 0)
-            {
-              event->_category = g_strdup ("S");
-            }
-            else if (g_strcmp0 (attr, "Vet40") == 0)
-            {
-              event->_category = g_strdup ("V1");
-            }
-            else if (g_strcmp0 (attr, "Vet50") == 0)
-            {
-              event->_category = g_strdup ("V2");
-            }
-            else if (g_strcmp0 (attr, "Vet60") == 0)
-            {
-              event->_category = g_strdup ("V3");
-            }
-            else if (g_strcmp0 (attr, "Vet70") == 0)
-            {
-              event->_category = g_strdup ("V4");
-            }
-            else if (g_strcmp0 (attr, "VetCombined") == 0)
-            {
-              event->_category = g_strdup ("VET");
-            }
-            else
-            {
-              event->_category = g_strdup ("S");
-            }
+      // EventDateTime
+      attr = (gchar *) xmlGetProp (xml_node, BAD_CAST "EventDateTime");
+      if (attr)
+      {
+        gchar **date = g_strsplit_set (attr,
+                                       " -:",
+                                       6);
+        if (date[0] && date[1] && date[2] && date[3] && date[4])
+        {
+          event->_year   = g_ascii_strtoll (date[0], nullptr, 10);
+          event->_month  = g_ascii_strtoll (date[1], nullptr, 10);
+          event->_day    = g_ascii_strtoll (date[2], nullptr, 10);
+          event->_hour   = g_ascii_strtoll (date[3], nullptr, 10);
+          event->_minute = g_ascii_strtoll (date[4], nullptr, 10);
+        }
 
-            xmlFree (attr);
-          }
+        g_strfreev (date);
+        xmlFree (attr);
+      }
 
-          // EventDateTime
-          attr = (gchar *) xmlGetProp (xml_nodeset->nodeTab[i], BAD_CAST "EventDateTime");
+      // Fencers
+      for (xmlNode *n = xml_node->children; n != nullptr; n = n->next)
+      {
+        if (n->type == XML_ELEMENT_NODE)
+        {
+          attr = (gchar *) xmlGetProp (n, BAD_CAST "CompetitorID");
           if (attr)
           {
-            gchar **date = g_strsplit_set (attr,
-                                           " -:",
-                                           6);
-            if (date[0] && date[1] && date[2] && date[3] && date[4])
-            {
-              event->_year   = g_ascii_strtoll (date[0], nullptr, 10);
-              event->_month  = g_ascii_strtoll (date[1], nullptr, 10);
-              event->_day    = g_ascii_strtoll (date[2], nullptr, 10);
-              event->_hour   = g_ascii_strtoll (date[3], nullptr, 10);
-              event->_minute = g_ascii_strtoll (date[4], nullptr, 10);
-            }
+            guint id = g_ascii_strtoll (attr, nullptr, 10);
 
-            g_strfreev (date);
+            event->_competitor_ids = g_list_prepend (event->_competitor_ids,
+                                                     GINT_TO_POINTER (id));
             xmlFree (attr);
           }
-
-          // Fencers
-          for (xmlNode *n = xml_nodeset->nodeTab[i]->children; n != nullptr; n = n->next)
-          {
-            if (n->type == XML_ELEMENT_NODE)
-            {
-              attr = (gchar *) xmlGetProp (n, BAD_CAST "CompetitorID");
-              if (attr)
-              {
-                guint       id     = g_ascii_strtoll (attr, nullptr, 10);
-                Competitor *competitor;
-
-                competitor = (Competitor *) g_hash_table_lookup (_competitors,
-                                                                 GINT_TO_POINTER (id));
-                event->_competitors = g_list_prepend (event->_competitors,
-                                                      competitor);
-
-                xmlFree (attr);
-              }
-            }
-          }
-
-          _events = g_list_prepend (_events,
-                                    event);
         }
       }
 
-      xmlXPathFreeObject  (xml_object);
+      _events = g_list_prepend (_events,
+                                event);
     }
+
   }
 }
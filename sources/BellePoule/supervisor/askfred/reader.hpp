@@ -47,6 +47,7 @@ namespace AskFred
         gchar *_gender;
         gchar *_licence;
         Club  *_club;
+        guint  _club_id;
         gchar *_rating_saber;
         gchar *_rating_epee;
         gchar *_rating_foil;
@@ -54,6 +55,7 @@ namespace AskFred
         guint  _ranking_epee;
         guint  _ranking_foil;
         GList *_members;
+        GList *_member_ids;
 
         Competitor ();
 
@@ -91,6 +93,7 @@ namespace AskFred
         guint _year;
 
         GList *_competitors;
+        GList *_competitor_ids;
 
         Event (const gchar *name,
                const gchar *location,
@@ -108,11 +111,14 @@ namespace AskFred
 
         GList *GetEvents ();
 
+        const gchar *GetError ();
+
       private:
         gchar *_name;
         gchar *_location;
         gchar *_organizer;
         gchar *_tournament_id;
+        gchar *_error;
 
         GList             *_events;
         GHashTable        *_competitors;
@@ -121,17 +127,23 @@ namespace AskFred
 
         virtual ~Parser ();
 
-        gboolean CheckData (xmlXPathContext *context);
+        void Read (const gchar *filename);
+
+        void ResolveReferences ();
+
+        GList *Resolve (GList *ids);
+
+        gboolean CheckData (xmlNode *xml_node);
 
-        void LoadTournament (xmlXPathContext *context);
+        void LoadTournament (xmlNode *xml_node);
 
-        void LoadCompetitors (xmlXPathContext *context);
+        void LoadCompetitor (xmlNode *xml_node);
 
-        void LoadTeams (xmlXPathContext *context);
+        void LoadTeam (xmlNode *xml_node);
 
-        void LoadClubs (xmlXPathContext *context);
+        void LoadClub (xmlNode *xml_node);
 
-        void LoadEvents (xmlXPathContext *context);
+        void LoadEvent (xmlNode *xml_node);
     };
   }
 }
@@ -36,9 +36,12 @@
 #include "util/data.hpp"
 #include "util/flash_code.hpp"
 #include "util/xml_scheme.hpp"
+#include "util/journal.hpp"
+#include "util/binary_snapshot.hpp"
 #include "actors/player_factory.hpp"
 #include "network/greg_uploader.hpp"
 #include "network/message.hpp"
+#include "network/upload_ledger.hpp"
 #include "actors/checkin.hpp"
 #include "actors/referees_list.hpp"
 #include "actors/player_factory.hpp"
@@ -198,7 +201,13 @@ Contest::Contest (GList    *advertisers,
 {
   Disclose ("BellePoule::Competition");
 
-  _save_timeout_id = 0;
+  _save_timeout_id   = 0;
+  _snapshot_writer   = nullptr;
+  _journal           = nullptr;
+  _journal_mark      = 0;
+  _journal_window_id = 0;
+  _replaying         = FALSE;
+  _upload_ledger     = new Net::UploadLedger ();
 
   _fie_id = g_strdup_printf ("%x", GetNetID ());
 
@@ -446,7 +455,8 @@ void Contest::LoadAskFred (AskFred::Reader::Event *askfred,
   {
     AttributeDesc             *league_desc = AttributeDesc::GetDescFromCodeName ("league");
     People::CheckinSupervisor *checkin;
-    GList                     *current  = askfred->_competitors;
+    GList                     *current     = askfred->_competitors;
+    GList                     *players     = nullptr;
 
     league_desc->_favorite_look = AttributeDesc::SHORT_TEXT;
     _schedule->CreateDefault ();
@@ -468,7 +478,8 @@ void Contest::LoadAskFred (AskFred::Reader::Event *askfred,
       AskFred::Reader::Competitor *competitor = (AskFred::Reader::Competitor *) current->data;
       Player                      *player     = competitor->CreatePlayer (askfred->_weapon);
 
-      checkin->Add (player);
+      players = g_list_prepend (players,
+                                player);
 
       if (player->Is ("Team"))
       {
@@ -477,19 +488,17 @@ void Contest::LoadAskFred (AskFred::Reader::Event *askfred,
 
         while (members)
         {
-          Player *member = (Player *) members->data;
-
-          checkin->Add (member);
-          member->Release ();
+          players = g_list_prepend (players,
+                                    members->data);
 
           members = g_slist_next (members);
         }
       }
 
-      player->Release ();
-
       current = g_list_next (current);
     }
+
+    checkin->AddPlayers (g_list_reverse (players));
   }
 
   FillInProperties ();
@@ -499,7 +508,10 @@ void Contest::LoadAskFred (AskFred::Reader::Event *askfred,
 void Contest::LoadXmlString (const guchar *string)
 {
   {
-    xmlDoc *doc = xmlParseDoc (string);
+    xmlDoc *doc = xmlReadDoc (string,
+                              nullptr,
+                              nullptr,
+                              XML_PARSE_NOBLANKS | XML_PARSE_COMPACT);
 
     if (doc)
     {
@@ -508,6 +520,7 @@ void Contest::LoadXmlString (const guchar *string)
       if (_save_timeout_id > 0)
       {
         g_source_remove (_save_timeout_id);
+        _save_timeout_id = 0;
       }
 
       xmlFreeDoc (doc);
@@ -551,7 +564,16 @@ void Contest::LoadXmlFile (const gchar *filename)
   if (g_file_test (_filename,
                    G_FILE_TEST_IS_REGULAR))
   {
-    xmlDoc *doc = xmlParseFile (filename);
+    xmlDoc *doc = BinarySnapshot::Load (filename);
+
+    if (doc == nullptr)
+    {
+      // Indentation nodes are useless to the loaders and account for
+      // about half of the tree of a saved contest.
+      doc = xmlReadFile (filename,
+                         nullptr,
+                         XML_PARSE_NOBLANKS | XML_PARSE_COMPACT);
+    }
 
     if (doc)
     {
@@ -577,6 +599,12 @@ void Contest::LoadXmlFile (const gchar *filename)
       if (_save_timeout_id > 0)
       {
         g_source_remove (_save_timeout_id);
+        _save_timeout_id = 0;
+      }
+
+      if (_filename)
+      {
+        ReplayJournal ();
       }
 
       xmlFreeDoc (doc);
@@ -983,6 +1011,8 @@ Contest::~Contest ()
 
   _state = State::LEAVING;
 
+  WaitForSnapshot (TRUE);
+
   // www
   if (_filename && Global::_www)
   {
@@ -1024,6 +1054,18 @@ Contest::~Contest ()
     g_source_remove (_save_timeout_id);
   }
 
+  if (_journal_window_id > 0)
+  {
+    g_source_remove (_journal_window_id);
+  }
+
+  if (_journal)
+  {
+    _journal->Flush ();
+  }
+  Object::TryToRelease (_journal);
+  _upload_ledger->Release ();
+
   if (_tournament)
   {
     _tournament->OnContestDeleted (this);
@@ -1055,6 +1097,14 @@ void Contest::SetFilename (gchar *filename)
   g_free (_filename);
   _filename = filename;
 
+  // The journal belongs to the previous file
+  if (_journal)
+  {
+    _journal->Flush ();
+  }
+  Object::TryToRelease (_journal);
+  _journal = nullptr;
+
   if (filename)
   {
     gchar *base_name = g_path_get_basename (_filename);
@@ -1411,14 +1461,99 @@ void Contest::MakeDirty ()
   gtk_widget_set_sensitive (_glade->GetWidget ("save_toolbutton"),
                             TRUE);
 
-  if (_save_timeout_id > 0)
+  if (_journal_window_id > 0)
   {
-    g_source_remove (_save_timeout_id);
+    // Already safe in the journal: only compact from time to time
+    if (_save_timeout_id == 0)
+    {
+      _save_timeout_id = g_timeout_add_seconds (60,
+                                                (GSourceFunc) OnSaveTimeout,
+                                                this);
+    }
+  }
+  else
+  {
+    if (_save_timeout_id > 0)
+    {
+      g_source_remove (_save_timeout_id);
+    }
+
+    _save_timeout_id = g_timeout_add_seconds (5,
+                                              (GSourceFunc) OnSaveTimeout,
+                                              this);
   }
+}
+
+// --------------------------------------------------------------------------------
+void Contest::Journalize (Net::Message *record)
+{
+  if (_filename && (_replaying == FALSE) && (_read_only == FALSE))
+  {
+    OpenJournal ();
+
+    // Records of the current main loop turn (e.g. "check all") are
+    // flushed together when the window closes.
+    if (_journal->Append (record))
+    {
+      // The dirty marks of the current event are covered by the record
+      if (_journal_window_id == 0)
+      {
+        _journal_window_id = g_idle_add ((GSourceFunc) OnJournalWindowClosed,
+                                         this);
+      }
+    }
+  }
+}
+
+// --------------------------------------------------------------------------------
+gboolean Contest::OnJournalWindowClosed (Contest *contest)
+{
+  contest->_journal_window_id = 0;
+
+  // Not on disk: only a full save will do
+  if (contest->_journal && (contest->_journal->Flush () == FALSE))
+  {
+    contest->MakeDirty ();
+  }
+
+  return G_SOURCE_REMOVE;
+}
+
+// --------------------------------------------------------------------------------
+void Contest::OpenJournal ()
+{
+  if (_journal == nullptr)
+  {
+    gchar *path = g_strdup_printf ("%s.journal", _filename);
+
+    _journal = new Journal (path);
+    g_free (path);
+  }
+}
+
+// --------------------------------------------------------------------------------
+void Contest::ReplayJournal ()
+{
+  GList *records;
+
+  OpenJournal ();
+  records = _journal->Read ();
+
+  if (records)
+  {
+    _replaying = TRUE;
+    for (GList *current = records; current; current = g_list_next (current))
+    {
+      OnMessage ((Net::Message *) current->data);
+    }
+    _replaying = FALSE;
+
+    g_list_free_full (records,
+                      (GDestroyNotify) Object::TryToRelease);
 
-  _save_timeout_id = g_timeout_add_seconds (5,
-                                            (GSourceFunc) OnSaveTimeout,
-                                            this);
+    // Fold the replayed changes into the file
+    MakeDirty ();
+  }
 }
 
 // --------------------------------------------------------------------------------
@@ -1863,7 +1998,7 @@ void Contest::AttachTo (GtkNotebook *to)
 }
 
 // --------------------------------------------------------------------------------
-void Contest::Publish ()
+void Contest::Publish (GBytes *snapshot)
 {
   if (_tournament)
   {
@@ -1891,6 +2026,8 @@ void Contest::Publish ()
                       (GFunc) Net::Advertiser::SetLink,
                       (gpointer) uploader->GetWWW ());
 
+      uploader->SetContent (snapshot);
+      uploader->SetLedger  (_upload_ledger);
       uploader->UploadFile (_filename);
       uploader->Release ();
     }
@@ -1904,6 +2041,9 @@ void Contest::Archive (const gchar *title)
   {
     Save ();
 
+    // The archive is made from the file on disk
+    WaitForSnapshot (TRUE);
+
     if (_filename)
     {
       gchar *zip_name = g_strdup (_filename);
@@ -1930,8 +2070,42 @@ void Contest::Save ()
 {
   if (_filename)
   {
+    WaitForSnapshot (FALSE);
+
+    BinarySnapshot *binary_snapshot = nullptr;
+
+    OpenJournal ();
+    _journal_mark = _journal->GetMark ();
+
+    {
+      GError   *error  = nullptr;
+      gboolean  binary = g_key_file_get_boolean (Global::_user_config->_key_file,
+                                                 "Competiton",
+                                                 "binary_snapshot",
+                                                 &error);
+
+      if (error)
+      {
+        binary = TRUE;
+        g_error_free (error);
+      }
+
+      if (binary)
+      {
+        binary_snapshot = new BinarySnapshot ();
+      }
+    }
+
+    _snapshot_writer = new SnapshotWriter (this,
+                                           Serialize (binary_snapshot));
+
     // Regular
-    Save (_filename);
+    _snapshot_writer->AddDestination (_filename);
+    if (binary_snapshot)
+    {
+      _snapshot_writer->EnableBinarySnapshot (binary_snapshot);
+      binary_snapshot->Release ();
+    }
 
     // www
     if (Global::_www)
@@ -1939,7 +2113,7 @@ void Contest::Save ()
       gchar *base_name = g_path_get_basename (_filename);
       gchar *www_file  = g_build_filename (Global::_www, base_name, NULL);
 
-      Save (www_file);
+      _snapshot_writer->AddDestination (www_file);
 
       g_free (base_name);
       g_free (www_file);
@@ -1955,13 +2129,57 @@ void Contest::Save ()
         gchar *base_name   = g_path_get_basename (_filename);
         gchar *backup_file = g_build_filename (location, base_name, NULL);
 
-        Save (backup_file);
+        _snapshot_writer->AddDestination (backup_file);
         g_free (base_name);
         g_free (backup_file);
       }
     }
 
-    Publish ();
+    _snapshot_writer->Start ();
+
+    gtk_widget_set_sensitive (_glade->GetWidget ("save_toolbutton"),
+                              FALSE);
+  }
+}
+
+// --------------------------------------------------------------------------------
+void Contest::WaitForSnapshot (gboolean publish)
+{
+  if (_snapshot_writer)
+  {
+    _snapshot_writer->Detach ();
+    _snapshot_writer->Join ();
+
+    if (publish)
+    {
+      Publish (_snapshot_writer->GetSnapshot ());
+    }
+
+    ReleaseSnapshotWriter ();
+  }
+}
+
+// --------------------------------------------------------------------------------
+void Contest::ReleaseSnapshotWriter ()
+{
+  // The records taken into the snapshot are not needed anymore
+  if (_journal && _snapshot_writer->PrimaryWritten ())
+  {
+    _journal->Compact (_journal_mark);
+  }
+
+  _snapshot_writer->Release ();
+  _snapshot_writer = nullptr;
+}
+
+// --------------------------------------------------------------------------------
+void Contest::OnSnapshotWritten (SnapshotWriter *writer)
+{
+  Publish (writer->GetSnapshot ());
+
+  if (writer == _snapshot_writer)
+  {
+    ReleaseSnapshotWriter ();
   }
 }
 
@@ -2087,24 +2305,25 @@ void Contest::SaveHeader (XmlScheme *xml_scheme)
 }
 
 // --------------------------------------------------------------------------------
-void Contest::Save (gchar *filename)
+xmlBuffer *Contest::Serialize (BinarySnapshot *binary_snapshot)
 {
-  if (filename)
+  xmlBuffer *xml_buffer = xmlBufferCreate ();
+
   {
-    {
-      XmlScheme *xml_scheme = new XmlScheme (filename);
+    XmlScheme *xml_scheme = new XmlScheme (xml_buffer,
+                                           TRUE);
 
-      SaveHeader (xml_scheme);
-      _schedule->Save (xml_scheme);
+    xml_scheme->SetBinarySnapshot (binary_snapshot);
 
-      xml_scheme->EndElement (); // toto
+    SaveHeader (xml_scheme);
+    _schedule->Save (xml_scheme);
 
-      xml_scheme->Release ();
-    }
+    xml_scheme->EndElement (); // toto
 
-    gtk_widget_set_sensitive (_glade->GetWidget ("save_toolbutton"),
-                              FALSE);
+    xml_scheme->Release ();
   }
+
+  return xml_buffer;
 }
 
 // --------------------------------------------------------------------------------
@@ -2199,6 +2418,9 @@ void Contest::DumpToHTML (gchar *filename)
   {
     FILE *file = g_fopen (filename, "w");
 
+    // Stages dump their html piece by piece
+    setvbuf (file, nullptr, _IOFBF, 64*1024);
+
     {
       fprintf (file,
                "<html>\n"
@@ -2349,7 +2571,24 @@ void Contest::AddFileToRecentManager (const gchar *filename)
 // --------------------------------------------------------------------------------
 gboolean Contest::OnMessage (Net::Message *message)
 {
-  return _schedule->OnMessage (message);
+  guint    pending_save = _save_timeout_id;
+  gboolean accepted     = _schedule->OnMessage (message);
+
+  // Only the scores a stage took are worth replaying
+  if (accepted && message->Is ("SmartPoule::Score"))
+  {
+    Journalize (message);
+
+    // The dirty marks raised while applying it are covered by the record
+    if ((pending_save == 0) && (_save_timeout_id > 0) && (_journal_window_id > 0))
+    {
+      g_source_remove (_save_timeout_id);
+      _save_timeout_id = 0;
+      MakeDirty ();
+    }
+  }
+
+  return accepted;
 }
 
 // --------------------------------------------------------------------------------
@@ -21,6 +21,7 @@
 #include <libxml/xpath.h>
 
 #include "util/module.hpp"
+#include "util/snapshot_writer.hpp"
 #include "network/advertiser.hpp"
 
 namespace People
@@ -39,9 +40,12 @@ namespace AskFred
 namespace Net
 {
   class Message;
+  class UploadLedger;
 }
 
 class Data;
+class Journal;
+class BinarySnapshot;
 class Tournament;
 class Weapon;
 class Category;
@@ -49,7 +53,8 @@ class Schedule;
 class XmlScheme;
 class Player;
 
-class Contest : public Module
+class Contest : public Module,
+                public SnapshotWriter::Listener
 {
   public:
     Contest (GList    *advertisers,
@@ -89,7 +94,7 @@ class Contest : public Module
 
     void DumpToFRD (gchar *filename);
 
-    void Publish ();
+    void Publish (GBytes *snapshot);
 
     gchar *GetFilename ();
 
@@ -110,6 +115,8 @@ class Contest : public Module
 
     void MakeDirty () override;
 
+    void Journalize (Net::Message *record) override;
+
     void Lock ();
 
     void UnLock ();
@@ -206,6 +213,12 @@ class Contest : public Module
     gboolean              _derived;
     GdkColor             *_gdk_color;
     guint                 _save_timeout_id;
+    SnapshotWriter       *_snapshot_writer;
+    Journal              *_journal;
+    guint                 _journal_mark;
+    guint                 _journal_window_id;
+    gboolean              _replaying;
+    Net::UploadLedger    *_upload_ledger;
     People::RefereesList *_referees_list;
     State                 _state;
     gboolean              _read_only;
@@ -226,7 +239,6 @@ class Contest : public Module
     gchar *GetSaveFileName      (GtkWidget   *chooser,
                                  const gchar *config_key,
                                  gint        *choice = NULL);
-    void   Save                 (gchar *filename);
     void   FillInProperties     ();
     void   FillInDate           (guint day,
                                  guint month,
@@ -246,6 +258,20 @@ class Contest : public Module
 
     static gboolean OnSaveTimeout (Contest *contest);
 
+    xmlBuffer *Serialize (BinarySnapshot *binary_snapshot);
+
+    void WaitForSnapshot (gboolean publish);
+
+    void ReleaseSnapshotWriter ();
+
+    void OpenJournal ();
+
+    void ReplayJournal ();
+
+    static gboolean OnJournalWindowClosed (Contest *contest);
+
+    void OnSnapshotWritten (SnapshotWriter *writer) override;
+
     void OnPlugged () override;
 
     void FeedParcel (Net::Message *parcel) override;
@@ -492,6 +492,30 @@ void Match::Save (XmlScheme *xml_scheme)
   }
 }
 
+// --------------------------------------------------------------------------------
+void Match::FeedScoreRecord (Net::Message *record)
+{
+  xmlBuffer *xml_buffer = xmlBufferCreate ();
+
+  // Same shape as the scores sent by the SmartPoule application
+  {
+    XmlScheme *xml_scheme = new XmlScheme (xml_buffer);
+
+    xml_scheme->StartElement ("Match");
+    for (guint i = 0; i < 2; i++)
+    {
+      Save (xml_scheme,
+            _opponents[i]._fencer);
+    }
+    xml_scheme->EndElement ();
+
+    xml_scheme->Release ();
+  }
+
+  record->Set ("xml", (const gchar *) xml_buffer->content);
+  xmlBufferFree (xml_buffer);
+}
+
 // --------------------------------------------------------------------------------
 void Match::Save (XmlScheme *xml_scheme,
                   Player    *fencer)
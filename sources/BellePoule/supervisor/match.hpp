@@ -96,6 +96,8 @@ class Match : public Object,
 
     void Save (XmlScheme *xml_scheme);
 
+    void FeedScoreRecord (Net::Message *record);
+
     void Load (xmlNode *node_a,
                Player  *fencer_a,
                xmlNode *node_b,
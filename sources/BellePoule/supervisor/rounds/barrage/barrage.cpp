@@ -200,8 +200,8 @@ namespace People
 
         player->SetAttributeValue (&rank_attr_id,
                                    previous_stage_rank->GetUIntValue ());
-        result = g_slist_append (result,
-                                 player);
+        result = g_slist_prepend (result,
+                                  player);
 
         current = g_slist_next (current);
       }
@@ -235,14 +235,14 @@ namespace People
           player->SetAttributeValue (&rank_attr_id,
                                      _short_list_length - (_ties_count - _promoted_count) + 1);
         }
-        result = g_slist_append (result,
-                                 player);
+        result = g_slist_prepend (result,
+                                  player);
 
         current = g_list_next (current);
       }
     }
 
-    return result;
+    return g_slist_reverse (result);
   }
 
   // --------------------------------------------------------------------------------
@@ -1102,6 +1102,19 @@ namespace People
     // Teams can't be toggled
     if (player && (player->Is ("Team") == FALSE))
     {
+      {
+        Net::Message *record = new Net::Message ("BellePoule::Attribute");
+
+        record->Set ("competition", _contest->GetNetID ());
+        record->Set ("stage",       GetNetID ());
+        record->Set ("fencer",      player->GetRef ());
+        record->Set ("attribute",   attr_id->_name);
+        record->Set ("value",       new_value);
+
+        Journalize (record);
+        record->Release ();
+      }
+
       Checkin::TogglePlayerAttr (player,
                                  attr_id,
                                  new_value,
@@ -1133,6 +1146,33 @@ namespace People
     }
   }
 
+  // --------------------------------------------------------------------------------
+  gboolean CheckinSupervisor::OnMessage (Net::Message *message)
+  {
+    if (message->Is ("BellePoule::Attribute"))
+    {
+      Player        *player = GetPlayerFromRef (message->GetInteger ("fencer"));
+      gchar         *name   = message->GetString ("attribute");
+      AttributeDesc *desc   = AttributeDesc::GetDescFromCodeName (name);
+
+      if (player && desc)
+      {
+        Player::AttributeId *attr_id = Player::AttributeId::Create (desc,
+                                                                    GetDataOwner ());
+
+        TogglePlayerAttr (player,
+                          attr_id,
+                          message->GetInteger ("value"));
+        attr_id->Release ();
+      }
+      g_free (name);
+
+      return TRUE;
+    }
+
+    return FALSE;
+  }
+
   // --------------------------------------------------------------------------------
   void CheckinSupervisor::OnListChanged ()
   {
@@ -1173,6 +1213,27 @@ namespace People
     supervisor->RegisterNewTeam (team);
   }
 
+  // --------------------------------------------------------------------------------
+  void CheckinSupervisor::AddPlayers (GList *players)
+  {
+    // The whole list makes a single list change
+    MuteListChanges (TRUE);
+    BatchAdditions (TRUE);
+    for (GList *current = players; current; current = g_list_next (current))
+    {
+      Player *player = (Player *) current->data;
+
+      Add (player);
+      player->Release ();
+    }
+    BatchAdditions (FALSE);
+    MuteListChanges (FALSE);
+
+    NotifyListChanged ();
+
+    g_list_free (players);
+  }
+
   // --------------------------------------------------------------------------------
   void CheckinSupervisor::Add (Player *player)
   {
@@ -1318,6 +1379,8 @@ namespace People
     }
     MuteListChanges (FALSE);
 
+    importer->DisplayReport ();
+
     importer->Release ();
   }
 
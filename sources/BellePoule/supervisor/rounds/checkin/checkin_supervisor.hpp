@@ -52,8 +52,12 @@ namespace People
 
       void Add (Player *player) override;
 
+      void AddPlayers (GList *players);
+
       void ReloadFencers ();
 
+      gboolean OnMessage (Net::Message *message) override;
+
     private:
       void OnLocked () override;
 
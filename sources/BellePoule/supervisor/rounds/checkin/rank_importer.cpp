@@ -24,11 +24,25 @@
 
 namespace People
 {
+  static const gdouble MIN_SIMILARITY   = 0.75;
+  static const gdouble AMBIGUITY_MARGIN = 0.05;
+  static const guint   MAX_REPORT_LINES = 30;
+
   // --------------------------------------------------------------------------------
   RankImporter::RankImporter (GKeyFile *config_file)
     : Object ("RankImporter")
   {
-    _rank_table = nullptr;
+    _rank_table  = nullptr;
+    _entries     = g_ptr_array_new_with_free_func ((GDestroyNotify) FreeEntry);
+    _key_table   = g_hash_table_new (g_str_hash,
+                                     g_str_equal);
+    _ngram_table = nullptr;
+
+    _approximate_report = g_string_new (nullptr);
+    _ambiguous_report   = g_string_new (nullptr);
+    _approximate_count  = 0;
+    _ambiguous_count    = 0;
+
     DisplayChooser (config_file);
   }
 
@@ -39,6 +53,28 @@ namespace People
     {
       g_hash_table_destroy (_rank_table);
     }
+
+    if (_ngram_table)
+    {
+      g_hash_table_destroy (_ngram_table);
+    }
+
+    g_hash_table_destroy (_key_table);
+    g_ptr_array_free (_entries,
+                      TRUE);
+
+    g_string_free (_approximate_report,
+                   TRUE);
+    g_string_free (_ambiguous_report,
+                   TRUE);
+  }
+
+  // --------------------------------------------------------------------------------
+  void RankImporter::FreeEntry (Entry *entry)
+  {
+    g_free (entry->_key);
+    g_free (entry->_label);
+    g_free (entry);
   }
 
   // --------------------------------------------------------------------------------
@@ -80,6 +116,47 @@ namespace People
         gchar *id       = g_strdup_printf ("%s:%s", name, first_name);
         guint  new_rank = GPOINTER_TO_UINT (g_hash_table_lookup (_rank_table, id));
 
+        if (new_rank == 0)
+        {
+          gchar    *key       = GetKey (name, first_name);
+          Entry    *entry     = (Entry *) g_hash_table_lookup (_key_table, key);
+          gboolean  ambiguous = FALSE;
+
+          if (entry)
+          {
+            ambiguous = entry->_ambiguous;
+          }
+          else
+          {
+            entry = FindNearest (key,
+                                 &ambiguous);
+
+            if (entry && (ambiguous == FALSE))
+            {
+              Report (_approximate_report,
+                      &_approximate_count,
+                      name,
+                      first_name,
+                      entry->_label);
+            }
+          }
+
+          if (ambiguous)
+          {
+            Report (_ambiguous_report,
+                    &_ambiguous_count,
+                    name,
+                    first_name,
+                    entry->_label);
+          }
+          else if (entry)
+          {
+            new_rank = entry->_rank;
+          }
+
+          g_free (key);
+        }
+
         if (new_rank == 0)
         {
           new_rank = _worst_rank+1;
@@ -95,6 +172,342 @@ namespace People
     }
   }
 
+  // --------------------------------------------------------------------------------
+  void RankImporter::DisplayReport ()
+  {
+    if (_approximate_count || _ambiguous_count)
+    {
+      GtkWidget *dialog;
+      GString   *text = g_string_new (nullptr);
+
+      if (_approximate_count)
+      {
+        g_string_append_printf (text,
+                                gettext ("Approximate matches (%u):\n%s\n"),
+                                _approximate_count,
+                                _approximate_report->str);
+      }
+
+      if (_ambiguous_count)
+      {
+        g_string_append_printf (text,
+                                gettext ("Ambiguous matches, left unranked (%u):\n%s"),
+                                _ambiguous_count,
+                                _ambiguous_report->str);
+      }
+
+      dialog = gtk_message_dialog_new (nullptr,
+                                       GTK_DIALOG_MODAL,
+                                       GTK_MESSAGE_WARNING,
+                                       GTK_BUTTONS_CLOSE,
+                                       "%s",
+                                       gettext ("Some fencers have no exact match in the rank file."));
+      gtk_message_dialog_format_secondary_text (GTK_MESSAGE_DIALOG (dialog),
+                                                "%s",
+                                                text->str);
+      gtk_dialog_run (GTK_DIALOG (dialog));
+      gtk_widget_destroy (dialog);
+
+      g_string_free (text,
+                     TRUE);
+    }
+  }
+
+  // --------------------------------------------------------------------------------
+  void RankImporter::Report (GString     *report,
+                             guint       *count,
+                             const gchar *name,
+                             const gchar *first_name,
+                             const gchar *candidate)
+  {
+    if (*count < MAX_REPORT_LINES)
+    {
+      g_string_append_printf (report,
+                              "%s %s  >>  %s\n",
+                              name,
+                              first_name,
+                              candidate);
+    }
+    else if (*count == MAX_REPORT_LINES)
+    {
+      g_string_append (report,
+                       "...\n");
+    }
+
+    (*count)++;
+  }
+
+  // --------------------------------------------------------------------------------
+  gchar *RankImporter::GetKey (const gchar *name,
+                               const gchar *first_name)
+  {
+    gchar     *full       = g_strdup_printf ("%s %s", name, first_name);
+    gchar     *decomposed = g_utf8_normalize (full,
+                                              -1,
+                                              G_NORMALIZE_NFD);
+    GString   *folded     = g_string_new (nullptr);
+    GPtrArray *tokens     = g_ptr_array_new ();
+    gchar    **words;
+    gchar     *key;
+
+    // Accents dropped, case folded, any punctuation or hyphen
+    // turned into a word separator
+    if (decomposed)
+    {
+      for (const gchar *p = decomposed; *p; p = g_utf8_next_char (p))
+      {
+        gunichar c = g_utf8_get_char (p);
+
+        if (g_unichar_ismark (c))
+        {
+          continue;
+        }
+        else if (g_unichar_isalnum (c))
+        {
+          g_string_append_unichar (folded,
+                                   g_unichar_tolower (c));
+        }
+        else
+        {
+          g_string_append_c (folded,
+                             ' ');
+        }
+      }
+    }
+
+    // Word order does not matter
+    words = g_strsplit (folded->str,
+                        " ",
+                        0);
+    for (guint i = 0; words[i] != nullptr; i++)
+    {
+      if (words[i][0] != '\0')
+      {
+        g_ptr_array_add (tokens,
+                         words[i]);
+      }
+    }
+    g_ptr_array_sort (tokens,
+                      (GCompareFunc) CompareTokens);
+    g_ptr_array_add (tokens,
+                     nullptr);
+
+    key = g_strjoinv (" ",
+                      (gchar **) tokens->pdata);
+
+    g_ptr_array_free (tokens,
+                      TRUE);
+    g_strfreev (words);
+    g_string_free (folded,
+                   TRUE);
+    g_free (decomposed);
+    g_free (full);
+
+    return key;
+  }
+
+  // --------------------------------------------------------------------------------
+  gint RankImporter::CompareTokens (const gchar **a,
+                                    const gchar **b)
+  {
+    return strcmp (*a, *b);
+  }
+
+  // --------------------------------------------------------------------------------
+  GHashTable *RankImporter::GetNgrams (const gchar *key)
+  {
+    GHashTable *ngrams = g_hash_table_new_full (g_str_hash,
+                                                g_str_equal,
+                                                g_free,
+                                                nullptr);
+    gchar      *padded = g_strdup_printf ("  %s ", key);
+    gsize       length = strlen (padded);
+
+    for (gsize i = 0; i+3 <= length; i++)
+    {
+      g_hash_table_add (ngrams,
+                        g_strndup (&padded[i], 3));
+    }
+
+    g_free (padded);
+
+    return ngrams;
+  }
+
+  // --------------------------------------------------------------------------------
+  void RankImporter::AddRank (const gchar *name,
+                              const gchar *first_name,
+                              guint        rank)
+  {
+    g_hash_table_insert (_rank_table,
+                         g_strdup_printf ("%s:%s", name, first_name),
+                         GUINT_TO_POINTER (rank));
+    UpdateWorstRank (rank);
+
+    {
+      gchar *key   = GetKey (name, first_name);
+      Entry *entry = (Entry *) g_hash_table_lookup (_key_table, key);
+
+      if (entry)
+      {
+        // Two rows that only differ by accents, case or word order
+        if (entry->_rank != rank)
+        {
+          entry->_ambiguous = TRUE;
+        }
+        g_free (key);
+      }
+      else
+      {
+        entry = g_new0 (Entry, 1);
+
+        entry->_key   = key;
+        entry->_label = g_strdup_printf ("%s %s", name, first_name);
+        entry->_rank  = rank;
+
+        g_ptr_array_add (_entries,
+                         entry);
+        g_hash_table_insert (_key_table,
+                             entry->_key,
+                             entry);
+      }
+    }
+  }
+
+  // --------------------------------------------------------------------------------
+  void RankImporter::BuildNgramIndex ()
+  {
+    _ngram_table = g_hash_table_new_full (g_str_hash,
+                                          g_str_equal,
+                                          g_free,
+                                          (GDestroyNotify) g_array_unref);
+
+    for (guint i = 0; i < _entries->len; i++)
+    {
+      Entry          *entry  = (Entry *) g_ptr_array_index (_entries, i);
+      GHashTable     *ngrams = GetNgrams (entry->_key);
+      GHashTableIter  iter;
+      gchar          *ngram;
+
+      entry->_ngram_count = g_hash_table_size (ngrams);
+
+      g_hash_table_iter_init (&iter,
+                              ngrams);
+      while (g_hash_table_iter_next (&iter,
+                                     (gpointer *) &ngram,
+                                     nullptr))
+      {
+        GArray *postings = (GArray *) g_hash_table_lookup (_ngram_table, ngram);
+
+        if (postings == nullptr)
+        {
+          postings = g_array_new (FALSE,
+                                  FALSE,
+                                  sizeof (guint));
+          g_hash_table_insert (_ngram_table,
+                               g_strdup (ngram),
+                               postings);
+        }
+
+        g_array_append_val (postings,
+                            i);
+      }
+
+      g_hash_table_destroy (ngrams);
+    }
+  }
+
+  // --------------------------------------------------------------------------------
+  RankImporter::Entry *RankImporter::FindNearest (const gchar *key,
+                                                  gboolean    *ambiguous)
+  {
+    Entry      *best        = nullptr;
+    gdouble     best_score  = 0.0;
+    gdouble     rival_score = 0.0;
+    GHashTable *ngrams      = GetNgrams (key);
+    guint       ngram_count = g_hash_table_size (ngrams);
+    guint      *shared      = g_new0 (guint, _entries->len);
+    GArray     *candidates  = g_array_new (FALSE,
+                                           FALSE,
+                                           sizeof (guint));
+
+    if (_ngram_table == nullptr)
+    {
+      BuildNgramIndex ();
+    }
+
+    // Count the trigrams each candidate has in common with the key
+    {
+      GHashTableIter  iter;
+      gchar          *ngram;
+
+      g_hash_table_iter_init (&iter,
+                              ngrams);
+      while (g_hash_table_iter_next (&iter,
+                                     (gpointer *) &ngram,
+                                     nullptr))
+      {
+        GArray *postings = (GArray *) g_hash_table_lookup (_ngram_table, ngram);
+
+        for (guint p = 0; postings && (p < postings->len); p++)
+        {
+          guint index = g_array_index (postings, guint, p);
+
+          if (shared[index] == 0)
+          {
+            g_array_append_val (candidates,
+                                index);
+          }
+          shared[index]++;
+        }
+      }
+    }
+
+    // Dice coefficient, then the best score of any candidate
+    // that would give another rank
+    for (guint pass = 0; pass < 2; pass++)
+    {
+      for (guint c = 0; c < candidates->len; c++)
+      {
+        guint    index = g_array_index (candidates, guint, c);
+        Entry   *entry = (Entry *) g_ptr_array_index (_entries, index);
+        gdouble  score = 2.0 * shared[index] / (ngram_count + entry->_ngram_count);
+
+        if (pass == 0)
+        {
+          if (score > best_score)
+          {
+            best       = entry;
+            best_score = score;
+          }
+        }
+        else if ((entry->_rank != best->_rank) && (score > rival_score))
+        {
+          rival_score = score;
+        }
+      }
+
+      if (best == nullptr)
+      {
+        break;
+      }
+    }
+
+    g_array_free (candidates,
+                  TRUE);
+    g_free (shared);
+    g_hash_table_destroy (ngrams);
+
+    if (best_score < MIN_SIMILARITY)
+    {
+      return nullptr;
+    }
+
+    *ambiguous = best->_ambiguous || (rival_score >= best_score - AMBIGUITY_MARGIN);
+
+    return best;
+  }
+
   // --------------------------------------------------------------------------------
   void RankImporter::DisplayChooser (GKeyFile *config_file)
   {
@@ -282,12 +695,11 @@ namespace People
                   rank = tokens[t];
                 }
                 rank_value = atoi (rank);
-                g_hash_table_insert (_rank_table,
-                                     g_strdup_printf ("%s:%s", name, first_name),
-                                     (gpointer) rank_value);
+                AddRank (name,
+                         first_name,
+                         rank_value);
                 g_free (name);
                 g_free (first_name);
-                UpdateWorstRank (rank_value);
 
                 g_strfreev (tokens);
               }
@@ -354,10 +766,9 @@ namespace People
             gchar *name_undivadable       = GetUndivadableText (name);
             gchar *first_name_undivadable = GetUndivadableText (first_name);
 
-            g_hash_table_insert (_rank_table,
-                                 g_strdup_printf ("%s:%s", name_undivadable, first_name_undivadable),
-                                 (gpointer) rank_value);
-            UpdateWorstRank (rank_value);
+            AddRank (name_undivadable,
+                     first_name_undivadable,
+                     rank_value);
 
             g_free (name_undivadable);
             g_free (first_name_undivadable);
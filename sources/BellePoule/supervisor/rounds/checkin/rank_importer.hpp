@@ -28,12 +28,55 @@ namespace People
 
       void ModifyRank (Player *fencer);
 
+      void DisplayReport ();
+
     private:
+      struct Entry
+      {
+        gchar    *_key;
+        gchar    *_label;
+        guint     _rank;
+        guint     _ngram_count;
+        gboolean  _ambiguous;
+      };
+
       GHashTable *_rank_table;
       guint       _worst_rank;
+      GPtrArray  *_entries;
+      GHashTable *_key_table;
+      GHashTable *_ngram_table;
+      GString    *_approximate_report;
+      GString    *_ambiguous_report;
+      guint       _approximate_count;
+      guint       _ambiguous_count;
 
       ~RankImporter () override;
 
+      void AddRank (const gchar *name,
+                    const gchar *first_name,
+                    guint        rank);
+
+      Entry *FindNearest (const gchar *key,
+                          gboolean    *ambiguous);
+
+      void BuildNgramIndex ();
+
+      void Report (GString     *report,
+                   guint       *count,
+                   const gchar *name,
+                   const gchar *first_name,
+                   const gchar *candidate);
+
+      static gchar *GetKey (const gchar *name,
+                            const gchar *first_name);
+
+      static gint CompareTokens (const gchar **a,
+                                 const gchar **b);
+
+      static GHashTable *GetNgrams (const gchar *key);
+
+      static void FreeEntry (Entry *entry);
+
       void LoadTxt (const gchar *filename);
 
       void LoadXml (const gchar *filename);
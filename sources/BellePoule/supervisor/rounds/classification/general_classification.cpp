@@ -41,6 +41,10 @@ namespace People
       Stage (stage_class),
       PlayersList ("general_classification.glade", this, NO_RIGHT)
   {
+    _merged_ranking = nullptr;
+    _merged_ranks   = nullptr;
+    _merged_token   = 0;
+
     // Player attributes to display
     {
       GSList *attr_list;
@@ -113,6 +117,7 @@ namespace People
   // --------------------------------------------------------------------------------
   GeneralClassification::~GeneralClassification ()
   {
+    DropMergedRanking ();
   }
 
   // --------------------------------------------------------------------------------
@@ -148,19 +153,15 @@ namespace People
   GSList *GeneralClassification::GetCurrentClassification ()
   {
     Player::AttributeId final_rank_attr_id ("final_rank");
-    GSList *full_result = g_slist_copy (_attendees->GetPresents ());
+    GSList *full_result;
     GSList *result      = nullptr;
 
     GiveShortListAFinalRank ();
 
     // Sort final list
-    if (full_result)
-    {
-      final_rank_attr_id.MakeRandomReady (GetAntiCheatToken ());
-      full_result = g_slist_sort_with_data (full_result,
-                                            (GCompareDataFunc) Player::Compare,
-                                            &final_rank_attr_id);
-    }
+    final_rank_attr_id.MakeRandomReady (GetAntiCheatToken ());
+    MergeRanking (&final_rank_attr_id);
+    full_result = g_slist_copy (_merged_ranking);
 
     // Remove black carded and exported
     {
@@ -205,8 +206,8 @@ namespace People
                 player->SetAttributeValue (&final_rank_attr_id,
                                            fencer_count - excluded_count);
               }
-              result = g_slist_append (result,
-                                       player);
+              result = g_slist_prepend (result,
+                                        player);
             }
           }
         }
@@ -217,7 +218,150 @@ namespace People
 
     g_slist_free (full_result);
 
-    return result;
+    return g_slist_reverse (result);
+  }
+
+  // --------------------------------------------------------------------------------
+  gpointer GeneralClassification::GetMergeKey (Player              *player,
+                                               Player::AttributeId *final_rank_attr_id)
+  {
+    Attribute *rank_attr = player->GetAttribute (final_rank_attr_id);
+
+    if (rank_attr)
+    {
+      return GUINT_TO_POINTER (rank_attr->GetUIntValue () + 1);
+    }
+
+    return GUINT_TO_POINTER (G_MAXUINT);
+  }
+
+  // --------------------------------------------------------------------------------
+  void GeneralClassification::MergeRanking (Player::AttributeId *final_rank_attr_id)
+  {
+    GSList *presents = _attendees->GetPresents ();
+    GSList *moved    = nullptr;
+    guint   count    = 0;
+
+    // The previous ranking is kept as long as the same fencers are
+    // present and the anti-cheat token is the same. Only the fencers
+    // whose final rank moved since then are put back in place.
+    if (_merged_ranks && (_merged_token == final_rank_attr_id->_anti_cheat_token))
+    {
+      for (GSList *current = presents; current; current = g_slist_next (current))
+      {
+        Player   *player = (Player *) current->data;
+        gpointer  key    = g_hash_table_lookup (_merged_ranks, player);
+
+        if (key == nullptr)
+        {
+          break;
+        }
+        else if (key != GetMergeKey (player, final_rank_attr_id))
+        {
+          moved = g_slist_prepend (moved,
+                                   player);
+        }
+        count++;
+      }
+    }
+
+    if (   (_merged_ranks == nullptr)
+        || (count != g_slist_length (presents))
+        || (count != g_hash_table_size (_merged_ranks))
+        || (g_slist_length (moved) > (count / 8)))
+    {
+      DropMergedRanking ();
+
+      _merged_ranks   = g_hash_table_new (nullptr,
+                                          nullptr);
+      _merged_token   = final_rank_attr_id->_anti_cheat_token;
+      _merged_ranking = g_slist_sort_with_data (g_slist_copy (presents),
+                                                (GCompareDataFunc) Player::Compare,
+                                                final_rank_attr_id);
+
+      for (GSList *current = _merged_ranking; current; current = g_slist_next (current))
+      {
+        Player *player = (Player *) current->data;
+
+        g_hash_table_insert (_merged_ranks,
+                             player,
+                             GetMergeKey (player, final_rank_attr_id));
+      }
+    }
+    else
+    {
+      GSList *remainder = nullptr;
+      GSList *merged    = nullptr;
+      GSList *left;
+      GSList *right;
+
+      // Take the moved fencers out first, so that what is left
+      // stays sorted, then merge them back in a single pass.
+      for (GSList *current = _merged_ranking; current; current = g_slist_next (current))
+      {
+        Player *player = (Player *) current->data;
+
+        if (g_hash_table_lookup (_merged_ranks, player) == GetMergeKey (player, final_rank_attr_id))
+        {
+          remainder = g_slist_prepend (remainder,
+                                       player);
+        }
+      }
+      remainder = g_slist_reverse (remainder);
+
+      moved = g_slist_sort_with_data (moved,
+                                      (GCompareDataFunc) Player::Compare,
+                                      final_rank_attr_id);
+
+      left  = remainder;
+      right = moved;
+      while (left || right)
+      {
+        if (   (right == nullptr)
+            || (left && (Player::Compare ((Player *) left->data,
+                                          (Player *) right->data,
+                                          final_rank_attr_id) <= 0)))
+        {
+          merged = g_slist_prepend (merged,
+                                    left->data);
+          left = g_slist_next (left);
+        }
+        else
+        {
+          merged = g_slist_prepend (merged,
+                                    right->data);
+          right = g_slist_next (right);
+        }
+      }
+
+      g_slist_free (remainder);
+      g_slist_free (_merged_ranking);
+      _merged_ranking = g_slist_reverse (merged);
+
+      for (GSList *current = moved; current; current = g_slist_next (current))
+      {
+        Player *player = (Player *) current->data;
+
+        g_hash_table_insert (_merged_ranks,
+                             player,
+                             GetMergeKey (player, final_rank_attr_id));
+      }
+    }
+
+    g_slist_free (moved);
+  }
+
+  // --------------------------------------------------------------------------------
+  void GeneralClassification::DropMergedRanking ()
+  {
+    g_slist_free (_merged_ranking);
+    _merged_ranking = nullptr;
+
+    if (_merged_ranks)
+    {
+      g_hash_table_destroy (_merged_ranks);
+      _merged_ranks = nullptr;
+    }
   }
 
   // --------------------------------------------------------------------------------
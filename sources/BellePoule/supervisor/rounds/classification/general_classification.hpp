@@ -47,6 +47,9 @@ namespace People
       static const gchar *_class_name;
       static const gchar *_xml_class_name;
       gulong              _place_entry_handle;
+      GSList             *_merged_ranking;
+      GHashTable         *_merged_ranks;
+      guint32             _merged_token;
 
       static Stage *CreateInstance (StageClass *stage_class);
 
@@ -62,6 +65,13 @@ namespace People
 
       void GiveShortListAFinalRank ();
 
+      void MergeRanking (Player::AttributeId *final_rank_attr_id);
+
+      void DropMergedRanking ();
+
+      static gpointer GetMergeKey (Player              *player,
+                                   Player::AttributeId *final_rank_attr_id);
+
       guint PreparePrint (GtkPrintOperation *operation,
                           GtkPrintContext   *context) override;
 
@@ -25,38 +25,67 @@
 
 namespace Generic
 {
+  gdouble *Elo::_expectations = nullptr;
+
   // --------------------------------------------------------------------------------
   Elo::Elo (guint K)
     : Object ("Generic::Elo")
   {
-     _K       = K;
-     _fencers = nullptr;
+     _K        = K;
+     _recovery = g_hash_table_new (nullptr,
+                                   nullptr);
   }
 
   // --------------------------------------------------------------------------------
   Elo::~Elo ()
   {
     CancelBatch ();
+    g_hash_table_destroy (_recovery);
   }
 
   // --------------------------------------------------------------------------------
   void Elo::ProcessBatch (GList *matches)
   {
-    Player::AttributeId elo_attr_id ("elo");
+    Player::AttributeId  elo_attr_id ("elo");
+    GHashTable          *ratings = g_hash_table_new (nullptr,
+                                                     nullptr);
 
     CancelBatch ();
 
+    // Ratings are worked out in a table and written back to
+    // the fencers once the whole batch has been processed.
     for (GList *m = matches; m; m = g_list_next (m))
     {
       Match *match = (Match *) m->data;
 
-      PreserveInitialValue (match);
-      Evaluate             (match);
+      PreserveInitialValue (match,
+                            ratings);
+      Evaluate             (match,
+                            ratings);
+    }
+
+    {
+      GHashTableIter iter;
+      gpointer       fencer;
+      gpointer       elo;
+
+      g_hash_table_iter_init (&iter,
+                              ratings);
+      while (g_hash_table_iter_next (&iter,
+                                     &fencer,
+                                     &elo))
+      {
+        ((Player *) fencer)->SetAttributeValue (&elo_attr_id,
+                                                GPOINTER_TO_UINT (elo));
+      }
     }
+
+    g_hash_table_destroy (ratings);
   }
 
   // --------------------------------------------------------------------------------
-  void Elo::PreserveInitialValue (Match *match)
+  void Elo::PreserveInitialValue (Match      *match,
+                                  GHashTable *ratings)
   {
     Player::AttributeId elo_attr_id ("elo");
 
@@ -64,23 +93,48 @@ namespace Generic
     {
       Player *fencer = match->GetOpponent (i);
 
-      if (g_list_find (_fencers,
-                       fencer) == nullptr)
+      if (g_hash_table_lookup_extended (_recovery,
+                                        fencer,
+                                        nullptr,
+                                        nullptr) == FALSE)
       {
         Attribute *elo_attr = fencer->GetAttribute (&elo_attr_id);
+        gpointer   elo      = GUINT_TO_POINTER (elo_attr->GetUIntValue ());
+
+        g_hash_table_insert (_recovery,
+                             fencer,
+                             elo);
+        g_hash_table_insert (ratings,
+                             fencer,
+                             elo);
+      }
+    }
+  }
 
-        fencer->SetData (this,
-                         "Elo::recovery",
-                         GUINT_TO_POINTER (elo_attr->GetUIntValue ()));
+  // --------------------------------------------------------------------------------
+  gdouble Elo::GetExpectation (gint delta)
+  {
+    if ((delta < -DELTA_MAX) || (delta > DELTA_MAX))
+    {
+      return 1 / (1 + pow (10, (gdouble) delta / 400));
+    }
 
-        _fencers = g_list_prepend (_fencers,
-                                   fencer);
+    if (_expectations == nullptr)
+    {
+      _expectations = g_new (gdouble, 2*DELTA_MAX + 1);
+
+      for (gint d = -DELTA_MAX; d <= DELTA_MAX; d++)
+      {
+        _expectations[d + DELTA_MAX] = 1 / (1 + pow (10, (gdouble) d / 400));
       }
     }
+
+    return _expectations[delta + DELTA_MAX];
   }
 
   // --------------------------------------------------------------------------------
-  void Elo::Evaluate (Match *match)
+  void Elo::Evaluate (Match      *match,
+                      GHashTable *ratings)
   {
     /*
       Rn = R0 + K (W - We) + G
@@ -95,21 +149,20 @@ namespace Generic
 
     if (match->IsOver ())
     {
-      Player::AttributeId elo_attr_id ("elo");
-      gdouble             elo[2];
-      gdouble             probability[2];
+      guint   elo[2];
+      gdouble probability[2];
 
       // elo
       for (guint f = 0; f < 2; f++)
       {
-        Player    *fencer   = (Player *) match->GetOpponent (f);
-        Attribute *elo_attr = fencer->GetAttribute (&elo_attr_id);
+        Player *fencer = (Player *) match->GetOpponent (f);
 
-        elo[f] = elo_attr->GetUIntValue ();
+        elo[f] = GPOINTER_TO_UINT (g_hash_table_lookup (ratings,
+                                                        fencer));
       }
 
       // probability
-      probability[0] = 1 / (1 + pow (10, (elo[1] - elo[0]) / 400));
+      probability[0] = GetExpectation (gint (elo[1]) - gint (elo[0]));
       probability[1] = 1 - probability[0];
 
       for (guint f = 0; f < 2; f++)
@@ -131,8 +184,9 @@ namespace Generic
           // Prevent elo from going negative.
           new_elo = 0;
         }
-        fencer->SetAttributeValue (&elo_attr_id,
-                                   (guint) new_elo);
+        g_hash_table_insert (ratings,
+                             fencer,
+                             GUINT_TO_POINTER ((guint) new_elo));
       }
     }
   }
@@ -150,21 +204,20 @@ namespace Generic
   void Elo::CancelBatch ()
   {
     Player::AttributeId elo_attr_id ("elo");
-
-    for (GList *f = _fencers; f; f = g_list_next (f))
+    GHashTableIter      iter;
+    gpointer            fencer;
+    gpointer            recovery;
+
+    g_hash_table_iter_init (&iter,
+                            _recovery);
+    while (g_hash_table_iter_next (&iter,
+                                   &fencer,
+                                   &recovery))
     {
-      Player *fencer   = (Player *) f->data;
-      guint   recovery = fencer->GetUIntData (this,
-                                              "Elo::recovery");
-
-      fencer->SetAttributeValue (&elo_attr_id,
-                                 recovery);
-
-      fencer->RemoveData (this,
-                          "Elo::recovery");
+      ((Player *) fencer)->SetAttributeValue (&elo_attr_id,
+                                              GPOINTER_TO_UINT (recovery));
     }
 
-    g_list_free (_fencers);
-    _fencers = nullptr;
+    g_hash_table_remove_all (_recovery);
   }
 }
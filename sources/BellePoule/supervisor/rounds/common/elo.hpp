@@ -35,12 +35,20 @@ namespace Generic
       virtual ~Elo ();
 
     private:
-      guint  _K;
-      GList *_fencers;
+      static const gint DELTA_MAX = 1600;
 
-      void PreserveInitialValue (Match *match);
+      static gdouble *_expectations;
 
-      void Evaluate (Match *match);
+      guint       _K;
+      GHashTable *_recovery;
+
+      void PreserveInitialValue (Match      *match,
+                                 GHashTable *ratings);
+
+      void Evaluate (Match      *match,
+                     GHashTable *ratings);
+
+      static gdouble GetExpectation (gint delta);
 
       virtual guint GetBonus (Match *match);
   };
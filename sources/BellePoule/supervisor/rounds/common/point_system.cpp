@@ -32,6 +32,9 @@ namespace Generic
   {
     _anti_cheat_block  = anti_cheat_block;
     _matches           = nullptr;
+    _last_match        = nullptr;
+    _rated_matches     = g_hash_table_new (nullptr,
+                                           nullptr);
     _elo_matters       = elo_matters;
     _reverse_insertion = reverse_insertion;
 
@@ -42,6 +45,7 @@ namespace Generic
   PointSystem::~PointSystem ()
   {
     g_list_free (_matches);
+    g_hash_table_destroy (_rated_matches);
 
     _elo->Release ();
   }
@@ -49,18 +53,31 @@ namespace Generic
   // --------------------------------------------------------------------------------
   void PointSystem::RateMatch (Match *match)
   {
-    if (g_list_find (_matches,
-                     match) == nullptr)
+    // The tableaux rate every match of the tree each time their
+    // classification is asked for: keep the insertion constant time.
+    if (g_hash_table_lookup (_rated_matches,
+                             match) == nullptr)
     {
+      g_hash_table_insert (_rated_matches,
+                           match,
+                           match);
+
       if (_reverse_insertion)
       {
         _matches = g_list_prepend (_matches,
                                    match);
       }
+      else if (_last_match)
+      {
+        g_list_append (_last_match,
+                       match);
+        _last_match = g_list_next (_last_match);
+      }
       else
       {
-        _matches = g_list_append (_matches,
-                                  match);
+        _matches    = g_list_append (_matches,
+                                     match);
+        _last_match = _matches;
       }
     }
   }
@@ -77,7 +94,10 @@ namespace Generic
     _elo->CancelBatch ();
 
     g_list_free (_matches);
-    _matches = nullptr;
+    _matches    = nullptr;
+    _last_match = nullptr;
+
+    g_hash_table_remove_all (_rated_matches);
   }
 
   // --------------------------------------------------------------------------------
@@ -49,6 +49,8 @@ namespace Generic
       GList *_matches;
 
     private:
+      GHashTable      *_rated_matches;
+      GList           *_last_match;
       Elo             *_elo;
       AntiCheatBlock  *_anti_cheat_block;
       gboolean         _elo_matters;
@@ -656,6 +656,19 @@ namespace Pool
                          Match          *match,
                          Player         *player)
   {
+    {
+      Net::Message *record = new Net::Message ("SmartPoule::Score");
+
+      record->Set ("competition", _parcel->GetInteger ("competition"));
+      record->Set ("stage",       _parcel->GetInteger ("stage"));
+      record->Set ("batch",       _number);
+      record->Set ("bout",        match->GetNumber ());
+      match->FeedScoreRecord (record);
+
+      Journalize (record);
+      record->Release ();
+    }
+
     _point_system->RateMatch (match);
     _point_system->Rehash ();
     RefreshScoreData ();
@@ -1659,6 +1672,111 @@ namespace Pool
     return 0;
   }
 
+  // --------------------------------------------------------------------------------
+  void Pool::GetCalculus (Player   *player,
+                          Object   *data_owner,
+                          Calculus *calculus)
+  {
+    Player::AttributeId  attr_id ("", data_owner);
+    Attribute           *status;
+
+    calculus->_player = player;
+
+    attr_id._name = (gchar *) "pool_nr";
+    calculus->_pool_nr = player->GetAttribute (&attr_id)->GetUIntValue ();
+
+    attr_id._name = (gchar *) "victories_ratio";
+    calculus->_ratio = player->GetAttribute (&attr_id)->GetUIntValue ();
+
+    attr_id._name = (gchar *) "indice";
+    calculus->_average = player->GetAttribute (&attr_id)->GetIntValue ();
+
+    attr_id._name = (gchar *) "HS";
+    calculus->_HS = player->GetAttribute (&attr_id)->GetUIntValue ();
+
+    attr_id._name = (gchar *) "status";
+    status = player->GetAttribute (&attr_id);
+    if (status)
+    {
+      calculus->_status = status->GetStrValue ()[0];
+    }
+    else
+    {
+      calculus->_status = 'Q';
+    }
+  }
+
+  // --------------------------------------------------------------------------------
+  gboolean Pool::IsTied (Calculus *A,
+                         Calculus *B)
+  {
+    // Same as ComparePlayer (WITH_CALCULUS) returning 0:
+    // two different status never tie.
+    return (   (A->_status  == B->_status)
+            && (A->_ratio   == B->_ratio)
+            && (A->_average == B->_average)
+            && (A->_HS      == B->_HS));
+  }
+
+  // --------------------------------------------------------------------------------
+  gint Pool::CompareCalculus (Calculus *A,
+                              Calculus *B,
+                              guint32   anti_cheat_token,
+                              guint     comparison_policy)
+  {
+    // Same order as ComparePlayer but on figures read beforehand
+    if (comparison_policy & WITH_CALCULUS)
+    {
+      if (A->_status != B->_status)
+      {
+        if (A->_status == 'E')
+        {
+          return 1;
+        }
+        if (B->_status == 'E')
+        {
+          return -1;
+        }
+      }
+
+      if (comparison_policy & WITH_POOL_NR)
+      {
+        if (B->_pool_nr != A->_pool_nr)
+        {
+          return A->_pool_nr - B->_pool_nr;
+        }
+      }
+
+      if (A->_status != B->_status)
+      {
+        return CompareStatus (A->_status,
+                              B->_status);
+      }
+
+      if (B->_ratio != A->_ratio)
+      {
+        return B->_ratio - A->_ratio;
+      }
+      if (B->_average != A->_average)
+      {
+        return B->_average - A->_average;
+      }
+      if (B->_HS != A->_HS)
+      {
+        return B->_HS - A->_HS;
+      }
+    }
+
+    if (comparison_policy & WITH_RANDOM)
+    {
+      return Player::RandomCompare (A->_player,
+                                    B->_player,
+                                    anti_cheat_token);
+    }
+
+    return 0;
+  }
+
   // --------------------------------------------------------------------------------
   void Pool::Lock ()
   {
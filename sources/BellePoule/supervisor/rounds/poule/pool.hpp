@@ -59,6 +59,16 @@ namespace Pool
         WITH_RANDOM   = 0x4
       } ComparisonPolicy;
 
+      struct Calculus
+      {
+        Player *_player;
+        gchar   _status;
+        guint   _pool_nr;
+        guint   _ratio;
+        gint    _average;
+        guint   _HS;
+      };
+
     public:
       Pool (Data           *max_score,
             guint           workload,
@@ -142,6 +152,18 @@ namespace Pool
                                  guint32   anti_cheat_token,
                                  guint     comparison_policy);
 
+      static void GetCalculus (Player   *player,
+                               Object   *data_owner,
+                               Calculus *calculus);
+
+      static gboolean IsTied (Calculus *A,
+                              Calculus *B);
+
+      static gint CompareCalculus (Calculus *A,
+                                   Calculus *B,
+                                   guint32   anti_cheat_token,
+                                   guint     comparison_policy);
+
       static void SetWaterMarkingPolicy (gboolean enabled);
 
       static gboolean WaterMarkingEnabled ();
@@ -391,53 +391,61 @@ namespace Pool
   // --------------------------------------------------------------------------------
   gboolean Allocator::OnMessage (Net::Message *message)
   {
-    for (GSList *current = _drop_zones; current; current = g_slist_next (current))
+    if (message->Is ("SmartPoule::ScoreSheetCall"))
     {
-      Pool *pool = GetPoolOf (current);
+      guint  batch = message->GetInteger ("batch");
+      Pool  *pool  = nullptr;
+
+      if (batch > 0)
+      {
+        pool = GetPool (batch-1);
+      }
 
-      if (message->Is ("SmartPoule::ScoreSheetCall"))
+      if (pool && (pool->GetNumber () == batch))
       {
-        if (pool->GetNumber () == message->GetInteger ("batch"))
+        Net::Message *response = new Net::Message ("BellePoule::ScoreSheet");
+        Player       *referee  = _contest->GetRefereeFromRef (message->GetInteger ("referee_id"));
+        gchar        *address  = message->GetString ("address");
+
         {
-          Net::Message *response = new Net::Message ("BellePoule::ScoreSheet");
-          Player       *referee  = _contest->GetRefereeFromRef (message->GetInteger ("referee_id"));
-          gchar        *address  = message->GetString ("address");
+          xmlBuffer *xml_buffer = xmlBufferCreate ();
 
           {
-            xmlBuffer *xml_buffer = xmlBufferCreate ();
-
-            {
-              XmlScheme *xml_scheme = new XmlScheme (xml_buffer);
+            XmlScheme *xml_scheme = new XmlScheme (xml_buffer);
 
-              _contest->SaveHeader (xml_scheme);
-              SaveHeader (xml_scheme);
-              pool->Save (xml_scheme);
+            _contest->SaveHeader (xml_scheme);
+            SaveHeader (xml_scheme);
+            pool->Save (xml_scheme);
 
-              xml_scheme->EndElement ();
-              xml_scheme->EndElement ();
+            xml_scheme->EndElement ();
+            xml_scheme->EndElement ();
 
-              xml_scheme->Release ();
-            }
+            xml_scheme->Release ();
+          }
 
-            response->Set ("competition", _contest->GetNetID ());
-            response->Set ("stage",       GetNetID ());
-            response->Set ("batch",       pool->GetNumber ());
-            response->Set ("xml",         (const gchar *) xml_buffer->content);
+          response->Set ("competition", _contest->GetNetID ());
+          response->Set ("stage",       GetNetID ());
+          response->Set ("batch",       pool->GetNumber ());
+          response->Set ("xml",         (const gchar *) xml_buffer->content);
 
-            xmlBufferFree (xml_buffer);
-          }
+          xmlBufferFree (xml_buffer);
+        }
 
-          referee->SendMessage (response,
-                                address);
-          g_free (address);
+        referee->SendMessage (response,
+                              address);
+        g_free (address);
 
-          response->Release ();
+        response->Release ();
 
-          return TRUE;
-        }
+        return TRUE;
       }
-      else if (message->Is ("BellePoule2D::Roadmap"))
+    }
+    else if (message->Is ("BellePoule2D::Roadmap"))
+    {
+      for (GSList *current = _drop_zones; current; current = g_slist_next (current))
       {
+        Pool *pool = GetPoolOf (current);
+
         if (pool->OnMessage (message))
         {
           OnPoolRoadmap (pool,
@@ -445,28 +453,28 @@ namespace Pool
           return TRUE;
         }
       }
-      else if (message->Is ("BellePoule2D::EndOfBurst"))
-      {
-        MakeDirty ();
-        SignalStatusUpdate ();
+    }
+    else if (message->Is ("BellePoule2D::EndOfBurst") && _drop_zones)
+    {
+      MakeDirty ();
+      SignalStatusUpdate ();
 
-        for (GSList *current_zone = _drop_zones; current_zone; current_zone = g_slist_next (current_zone))
-        {
-          PoolZone *zone = (PoolZone *) current_zone->data;
+      for (GSList *current_zone = _drop_zones; current_zone; current_zone = g_slist_next (current_zone))
+      {
+        PoolZone *zone = (PoolZone *) current_zone->data;
 
-          FillPoolTable (zone);
-        }
+        FillPoolTable (zone);
+      }
 
-        FixUpTablesBounds ();
+      FixUpTablesBounds ();
 
-        if (Locked ())
-        {
-          Stage *next_stage = GetNextStage ();
+      if (Locked ())
+      {
+        Stage *next_stage = GetNextStage ();
 
-          next_stage->OnMessage (message);
-        }
-        return TRUE;
+        next_stage->OnMessage (message);
       }
+      return TRUE;
     }
 
     return FALSE;
@@ -301,9 +301,9 @@ namespace Pool
   }
 
   // --------------------------------------------------------------------------------
-  gint Supervisor::CompareCurrentRoundClassification (Player     *A,
-                                                      Player     *B,
-                                                      Supervisor *pool_supervisor)
+  gint Supervisor::CompareClassification (Pool::Calculus *A,
+                                          Pool::Calculus *B,
+                                          Supervisor     *pool_supervisor)
   {
     guint policy = Pool::WITH_CALCULUS | Pool::WITH_RANDOM;
 
@@ -312,30 +312,10 @@ namespace Pool
       policy |= Pool::WITH_POOL_NR;
     }
 
-    return Pool::ComparePlayer (A,
-                                B,
-                                pool_supervisor->_current_round_owner,
-                                pool_supervisor->GetAntiCheatToken (),
-                                policy);
-  }
-
-  // --------------------------------------------------------------------------------
-  gint Supervisor::CompareCombinedRoundsClassification (Player     *A,
-                                                        Player     *B,
-                                                        Supervisor *pool_supervisor)
-  {
-    guint policy = Pool::WITH_CALCULUS | Pool::WITH_RANDOM;
-
-    if (pool_supervisor->_allocator->SeedingIsBalanced () == FALSE)
-    {
-      policy |= Pool::WITH_POOL_NR;
-    }
-
-    return Pool::ComparePlayer (A,
-                                B,
-                                pool_supervisor,
-                                pool_supervisor->GetAntiCheatToken (),
-                                policy);
+    return Pool::CompareCalculus (A,
+                                  B,
+                                  pool_supervisor->GetAntiCheatToken (),
+                                  policy);
   }
 
   // --------------------------------------------------------------------------------
@@ -930,7 +910,7 @@ rendering:
     {
       result = EvaluateClassification (result,
                                        _current_round_owner,
-                                       (GCompareDataFunc) CompareCurrentRoundClassification);
+                                       _current_round_owner);
 
       UpdateClassification (_current_round_classification,
                             result);
@@ -941,66 +921,95 @@ rendering:
     {
       return EvaluateClassification (result,
                                      this,
-                                     (GCompareDataFunc) CompareCombinedRoundsClassification);
+                                     this);
     }
     else
     {
       return EvaluateClassification (result,
-                                     this,
-                                     (GCompareDataFunc) CompareCurrentRoundClassification);
+                                     _current_round_owner,
+                                     this);
     }
   }
 
   // --------------------------------------------------------------------------------
-  GSList *Supervisor::EvaluateClassification (GSList           *list,
-                                              Object           *rank_owner,
-                                              GCompareDataFunc  CompareFunction)
+  GSList *Supervisor::EvaluateClassification (GSList *list,
+                                              Object *data_owner,
+                                              Object *rank_owner)
   {
-    Player::AttributeId *attr_id = new Player::AttributeId ("rank", rank_owner);
-    GSList              *result;
-    GSList              *current;
-    guint                previous_rank   = 0;
-    Player              *previous_player = nullptr;
-
-    if (CompareFunction)
-    {
-      result = g_slist_sort_with_data (list,
-                                       CompareFunction,
-                                       this);
-    }
-    else
+    Player::AttributeId *attr_id       = new Player::AttributeId ("rank", rank_owner);
+    guint                length        = g_slist_length (list);
+    Pool::Calculus      *calculus      = g_new (Pool::Calculus, length);
+    GSList              *sorted        = nullptr;
+    guint                previous_rank = 0;
+    Pool::Calculus       rank_calculus[2];
+
+    // The figures of each fencer are read once and packed so that
+    // neither the sort nor the tie detection look them up again.
     {
-      result = list;
-    }
+      GSList *current = list;
 
-    current = result;
-    for (guint i = 1; current; i++)
-    {
-      Player *player = (Player *) current->data;
-
-      if (   previous_player
-          && (Pool::ComparePlayer (player,
-                                   previous_player,
-                                   rank_owner,
-                                   0,
-                                   Pool::WITH_CALCULUS) == 0))
+      for (guint i = 0; current; i++)
       {
-        player->SetAttributeValue (attr_id,
-                                   previous_rank);
+        Pool::GetCalculus ((Player *) current->data,
+                           data_owner,
+                           &calculus[i]);
+        sorted = g_slist_prepend (sorted,
+                                  &calculus[i]);
+        current = g_slist_next (current);
       }
-      else
+      sorted = g_slist_reverse (sorted);
+    }
+
+    sorted = g_slist_sort_with_data (sorted,
+                                     (GCompareDataFunc) CompareClassification,
+                                     this);
+
+    // Tie groups are found in the same pass that gives the ranks
+    {
+      GSList *current = list;
+      GSList *key     = sorted;
+
+      for (guint i = 1; key; i++)
       {
-        player->SetAttributeValue (attr_id,
-                                   i);
-        previous_rank = i;
-      }
+        Pool::Calculus *mine     = (Pool::Calculus *) key->data;
+        Pool::Calculus *ranking  = &rank_calculus[i%2];
+        Pool::Calculus *previous = &rank_calculus[(i+1)%2];
+
+        if (rank_owner == data_owner)
+        {
+          *ranking = *mine;
+        }
+        else
+        {
+          Pool::GetCalculus (mine->_player,
+                             rank_owner,
+                             ranking);
+        }
+
+        if ((i > 1) && Pool::IsTied (ranking, previous))
+        {
+          mine->_player->SetAttributeValue (attr_id,
+                                            previous_rank);
+        }
+        else
+        {
+          mine->_player->SetAttributeValue (attr_id,
+                                            i);
+          previous_rank = i;
+        }
+
+        current->data = mine->_player;
 
-      previous_player = player;
-      current = g_slist_next (current);
+        current = g_slist_next (current);
+        key     = g_slist_next (key);
+      }
     }
+
+    g_slist_free (sorted);
+    g_free (calculus);
     attr_id->Release ();
 
-    return result;
+    return list;
   }
 
   // --------------------------------------------------------------------------------
@@ -96,9 +96,9 @@ namespace Pool
 
       GSList *GetCurrentClassification () override;
 
-      GSList *EvaluateClassification (GSList           *list,
-                                      Object           *rank_owner,
-                                      GCompareDataFunc  CompareFunction);
+      GSList *EvaluateClassification (GSList *list,
+                                      Object *data_owner,
+                                      Object *rank_owner);
 
       void SetInputProvider (Stage *input_provider) override;
 
@@ -122,12 +122,8 @@ namespace Pool
 
       void OnPoolStatus (Pool *pool) override;
 
-      static gint CompareCurrentRoundClassification (Player     *A,
-                                                     Player     *B,
-                                                     Supervisor *pool_supervisor);
-
-      static gint CompareCombinedRoundsClassification (Player     *A,
-                                                       Player     *B,
-                                                       Supervisor *pool_supervisor);
+      static gint CompareClassification (Pool::Calculus *A,
+                                         Pool::Calculus *B,
+                                         Supervisor     *pool_supervisor);
   };
 }
@@ -266,7 +266,10 @@ namespace People
   {
     GSList *remaining = CreateCustomList (PresentPlayerFilter, this);
 
-    if (remaining)
+    // The list comes out in display order. As long as the short list
+    // did not change upstream, that is the order stage_start_rank was
+    // given in, so the cut is already sorted.
+    if (remaining && (Stage::SameOrder (GetShortList (), _player_list) == FALSE))
     {
       Player::AttributeId attr_id ("stage_start_rank",
                                    this);
@@ -34,12 +34,34 @@ namespace Table
     _table        = nullptr;
     _table_width  = 0;
     _table_height = 0;
+
+    _name_attr_id       = CreateAttributeId ("name");
+    _first_name_attr_id = CreateAttributeId ("first_name");
+    _country_attr_id    = CreateAttributeId ("country");
   }
 
   // --------------------------------------------------------------------------------
   HtmlTable::~HtmlTable ()
   {
     g_free (_table);
+
+    _name_attr_id->Release ();
+    _first_name_attr_id->Release ();
+    _country_attr_id->Release ();
+  }
+
+  // --------------------------------------------------------------------------------
+  Player::AttributeId *HtmlTable::CreateAttributeId (const gchar *attr_name)
+  {
+    AttributeDesc *desc = AttributeDesc::GetDescFromCodeName (attr_name);
+
+    if (desc->_scope == AttributeDesc::Scope::LOCAL)
+    {
+      return new Player::AttributeId (desc->_code_name,
+                                      _owner);
+    }
+
+    return new Player::AttributeId (desc->_code_name);
   }
 
   // --------------------------------------------------------------------------------
@@ -93,102 +115,99 @@ namespace Table
   }
 
   // --------------------------------------------------------------------------------
-  void HtmlTable::DumpToHTML (FILE                *file,
+  void HtmlTable::DumpToHTML (GString             *html,
                               Player              *fencer,
-                              const gchar         *attr_name,
+                              Player::AttributeId *attr_id,
                               AttributeDesc::Look  look)
 
   {
-    AttributeDesc       *desc = AttributeDesc::GetDescFromCodeName (attr_name);
-    Player::AttributeId *attr_id;
-    Attribute           *attr;
+    Attribute *attr = fencer->GetAttribute (attr_id);
 
-    if (desc->_scope == AttributeDesc::Scope::LOCAL)
+    if (attr)
+    {
+      gchar *attr_image = attr->GetUserImage (look);
+
+      g_string_append_printf (html, "<span class=\"%s\">%s </span>", attr_id->_name, attr_image);
+      g_free (attr_image);
+    }
+  }
+
+  // --------------------------------------------------------------------------------
+  void HtmlTable::DumpMatch (GString *html,
+                             Match   *match,
+                             guint    column)
+  {
+    Player *winner = match->GetWinner ();
+
+    if (column == 0)
+    {
+      g_string_append (html, "              <td class=\"TableCellFirstCol\">");
+    }
+    else if (column == _table_width-1)
     {
-      attr_id = new Player::AttributeId (desc->_code_name,
-                                         _owner);
+      g_string_append (html, "              <td class=\"TableCellLastCol\">");
     }
     else
     {
-      attr_id = new Player::AttributeId (desc->_code_name);
+      g_string_append (html, "              <td class=\"TableCell\">");
     }
 
-    attr = fencer->GetAttribute (attr_id);
-    attr_id->Release ();
-
-    if (attr)
+    if (match->GetName ())
     {
-      gchar *attr_image = attr->GetUserImage (look);
+      gchar *scoreA = match->GetScore ((guint) 0)->GetImage ();
+      gchar *scoreB = match->GetScore ((guint) 1)->GetImage ();
 
-      fprintf (file, "<span class=\"%s\">%s </span>", attr_name, attr_image);
-      g_free (attr_image);
+      g_string_append_printf (html, "<span class=\"TableScore\">%s-%s</span>", scoreA, scoreB);
+
+      g_free (scoreA);
+      g_free (scoreB);
     }
+
+    if (winner)
+    {
+      DumpToHTML (html,
+                  winner,
+                  _name_attr_id,
+                  AttributeDesc::LONG_TEXT);
+      DumpToHTML (html,
+                  winner,
+                  _first_name_attr_id,
+                  AttributeDesc::LONG_TEXT);
+      DumpToHTML (html,
+                  winner,
+                  _country_attr_id,
+                  AttributeDesc::SHORT_TEXT);
+    }
+
+    g_string_append (html, "</td>\n");
   }
 
   // --------------------------------------------------------------------------------
-  void HtmlTable::DumpToHTML (FILE *file)
+  void HtmlTable::DumpToHTML (GString *html)
   {
     for (guint r = 0; r < _table_height; r++)
     {
-      fprintf (file, "            <tr>\n");
+      g_string_append (html, "            <tr>\n");
       for (guint c = 0; c < _table_width; c++)
       {
         void *data = _table[r*_table_width + c];
 
         if (data == CONNECTOR)
         {
-          fprintf (file, "              <td class=\"TableConnector\">|</td>\n");
+          g_string_append (html, "              <td class=\"TableConnector\">|</td>\n");
         }
         else if (data)
         {
-          Match  *match  = (Match *) data;
-          Player *winner = (Player *) match->GetWinner ();
-
-          if (c == 0)
-          {
-            fprintf (file, "              <td class=\"TableCellFirstCol\">");
-          }
-          else if (c == _table_width-1)
-          {
-            fprintf (file, "              <td class=\"TableCellLastCol\">");
-          }
-          else
-          {
-            fprintf (file, "              <td class=\"TableCell\">");
-          }
-
-          if (match->GetName ())
-          {
-            Score *scoreA = match->GetScore ((guint) 0);
-            Score *scoreB = match->GetScore ((guint) 1);
-
-            fprintf (file, "<span class=\"TableScore\">%s-%s</span>", scoreA->GetImage (), scoreB->GetImage ());
-          }
-
-          if (winner)
-          {
-            DumpToHTML (file,
-                        winner,
-                        "name",
-                        AttributeDesc::LONG_TEXT);
-            DumpToHTML (file,
-                        winner,
-                        "first_name",
-                        AttributeDesc::LONG_TEXT);
-            DumpToHTML (file,
-                        winner,
-                        "country",
-                        AttributeDesc::SHORT_TEXT);
-          }
-
-          fprintf (file, "</td>\n");
+          DumpMatch (html,
+                     (Match *) data,
+                     c);
         }
         else
         {
-          fprintf (file, "              <td class=\"EmptyTableCell\"></td>\n");
+          g_string_append (html, "              <td class=\"EmptyTableCell\"></td>\n");
         }
       }
-      fprintf (file, "            </tr>\n");
+      g_string_append (html, "            </tr>\n");
     }
   }
 }
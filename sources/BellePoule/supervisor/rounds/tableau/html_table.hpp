@@ -18,8 +18,8 @@
 
 #include "util/object.hpp"
 #include "util/attribute_desc.hpp"
+#include "util/player.hpp"
 
-class Player;
 class Match;
 
 namespace Table
@@ -40,19 +40,28 @@ namespace Table
       void Connect (Match *m1,
                     Match *m2);
 
-      void DumpToHTML (FILE *file);
+      void DumpToHTML (GString *html);
 
     private:
-      void   **_table;
-      guint    _table_width;
-      guint    _table_height;
-      Object  *_owner;
+      void                **_table;
+      guint                 _table_width;
+      guint                 _table_height;
+      Object               *_owner;
+      Player::AttributeId  *_name_attr_id;
+      Player::AttributeId  *_first_name_attr_id;
+      Player::AttributeId  *_country_attr_id;
 
       virtual ~HtmlTable ();
 
-      void DumpToHTML (FILE                *file,
+      Player::AttributeId *CreateAttributeId (const gchar *attr_name);
+
+      void DumpMatch (GString *html,
+                      Match   *match,
+                      guint    column);
+
+      void DumpToHTML (GString             *html,
                        Player              *fencer,
-                       const gchar         *attr_name,
+                       Player::AttributeId *attr_id,
                        AttributeDesc::Look  look);
   };
 }
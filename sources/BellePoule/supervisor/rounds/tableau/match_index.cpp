@@ -0,0 +1,318 @@
+// Copyright (C) 2009 Yannick Le Roux.
+// This file is part of BellePoule.
+//
+//   BellePoule is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   BellePoule is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with BellePoule.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "util/attribute.hpp"
+#include "util/player.hpp"
+#include "../../match.hpp"
+
+#include "table.hpp"
+#include "match_index.hpp"
+
+namespace Table
+{
+  // --------------------------------------------------------------------------------
+  MatchIndex::MatchIndex ()
+    : Object ("MatchIndex")
+  {
+    _numbers       = g_hash_table_new (nullptr,
+                                       nullptr);
+    _match_numbers = g_hash_table_new (nullptr,
+                                       nullptr);
+    _prefixes      = g_hash_table_new_full (g_str_hash,
+                                            g_str_equal,
+                                            g_free,
+                                            (GDestroyNotify) g_ptr_array_unref);
+    _match_keys    = g_hash_table_new_full (nullptr,
+                                            nullptr,
+                                            nullptr,
+                                            (GDestroyNotify) g_ptr_array_unref);
+  }
+
+  // --------------------------------------------------------------------------------
+  MatchIndex::~MatchIndex ()
+  {
+    g_hash_table_destroy (_numbers);
+    g_hash_table_destroy (_match_numbers);
+    g_hash_table_destroy (_prefixes);
+    g_hash_table_destroy (_match_keys);
+  }
+
+  // --------------------------------------------------------------------------------
+  void MatchIndex::Clear ()
+  {
+    g_hash_table_remove_all (_numbers);
+    g_hash_table_remove_all (_match_numbers);
+    g_hash_table_remove_all (_prefixes);
+    g_hash_table_remove_all (_match_keys);
+  }
+
+  // --------------------------------------------------------------------------------
+  gpointer MatchIndex::GetNumberKey (Table *table,
+                                     gint   number)
+  {
+    return GUINT_TO_POINTER ((table->GetNumber () << 16) | (guint) number);
+  }
+
+  // --------------------------------------------------------------------------------
+  gboolean MatchIndex::Contains (GPtrArray *matches,
+                                 Match     *match)
+  {
+    for (guint i = 0; i < matches->len; i++)
+    {
+      if (g_ptr_array_index (matches, i) == match)
+      {
+        return TRUE;
+      }
+    }
+
+    return FALSE;
+  }
+
+  // --------------------------------------------------------------------------------
+  gchar *MatchIndex::Normalize (const gchar *text)
+  {
+    GString *key        = g_string_new (nullptr);
+    gchar   *decomposed = g_utf8_normalize (text,
+                                            -1,
+                                            G_NORMALIZE_NFD);
+
+    if (decomposed)
+    {
+      for (gchar *c = decomposed; *c; c = g_utf8_next_char (c))
+      {
+        gunichar u = g_utf8_get_char (c);
+
+        if (g_unichar_isalnum (u))
+        {
+          g_string_append_unichar (key,
+                                   g_unichar_tolower (u));
+        }
+      }
+      g_free (decomposed);
+    }
+
+    return g_string_free (key, FALSE);
+  }
+
+  // --------------------------------------------------------------------------------
+  void MatchIndex::AddWord (Match       *match,
+                            const gchar *word)
+  {
+    gchar     *normalized = Normalize (word);
+    GPtrArray *match_keys = (GPtrArray *) g_hash_table_lookup (_match_keys,
+                                                               match);
+    guint      length     = MIN (strlen (normalized), MAX_PREFIX_LENGTH);
+
+    for (guint l = 1; l <= length; l++)
+    {
+      gchar     *prefix  = g_strndup (normalized, l);
+      GPtrArray *matches = (GPtrArray *) g_hash_table_lookup (_prefixes,
+                                                              prefix);
+
+      if (matches == nullptr)
+      {
+        matches = g_ptr_array_new ();
+        g_hash_table_insert (_prefixes,
+                             g_strdup (prefix),
+                             matches);
+      }
+
+      if (Contains (matches, match) == FALSE)
+      {
+        g_ptr_array_add (matches,
+                         match);
+        g_ptr_array_add (match_keys,
+                         prefix);
+      }
+      else
+      {
+        g_free (prefix);
+      }
+    }
+
+    g_free (normalized);
+  }
+
+  // --------------------------------------------------------------------------------
+  void MatchIndex::AddText (Match       *match,
+                            const gchar *text)
+  {
+    if (text)
+    {
+      gchar **words = g_strsplit_set (text,
+                                      " -'",
+                                      0);
+
+      for (guint i = 0; words[i] != nullptr; i++)
+      {
+        if (words[i][0])
+        {
+          AddWord (match,
+                   words[i]);
+        }
+      }
+
+      g_strfreev (words);
+    }
+  }
+
+  // --------------------------------------------------------------------------------
+  void MatchIndex::AddFencer (Match  *match,
+                              Player *fencer)
+  {
+    static const gchar *attributes[] = {"name", "first_name", "club", nullptr};
+
+    for (guint i = 0; attributes[i] != nullptr; i++)
+    {
+      Player::AttributeId  attr_id (attributes[i]);
+      Attribute           *attr = fencer->GetAttribute (&attr_id);
+
+      if (attr)
+      {
+        gchar *image = attr->GetUserImage (AttributeDesc::LONG_TEXT);
+
+        AddText (match,
+                 image);
+        g_free (image);
+      }
+    }
+
+    // Full name, so that "dupontjean" can be typed as well
+    {
+      gchar *name = fencer->GetName ();
+
+      AddWord (match,
+               name);
+      g_free (name);
+    }
+  }
+
+  // --------------------------------------------------------------------------------
+  void MatchIndex::Remove (Match *match)
+  {
+    GPtrArray *match_keys = (GPtrArray *) g_hash_table_lookup (_match_keys,
+                                                               match);
+
+    if (match_keys)
+    {
+      for (guint i = 0; i < match_keys->len; i++)
+      {
+        const gchar *prefix  = (const gchar *) g_ptr_array_index (match_keys, i);
+        GPtrArray   *matches = (GPtrArray *) g_hash_table_lookup (_prefixes,
+                                                                  prefix);
+
+        if (matches)
+        {
+          g_ptr_array_remove_fast (matches,
+                                   match);
+          if (matches->len == 0)
+          {
+            g_hash_table_remove (_prefixes,
+                                 prefix);
+          }
+        }
+      }
+
+      g_hash_table_remove (_match_keys,
+                           match);
+    }
+
+    {
+      gpointer number_key;
+
+      if (g_hash_table_lookup_extended (_match_numbers,
+                                        match,
+                                        nullptr,
+                                        &number_key))
+      {
+        g_hash_table_remove (_numbers,
+                             number_key);
+        g_hash_table_remove (_match_numbers,
+                             match);
+      }
+    }
+  }
+
+  // --------------------------------------------------------------------------------
+  void MatchIndex::Refresh (Match *match,
+                            Table *table)
+  {
+    Player *A = match->GetOpponent (0);
+    Player *B = match->GetOpponent (1);
+
+    Remove (match);
+
+    if (A && B)
+    {
+      g_hash_table_insert (_match_keys,
+                           match,
+                           g_ptr_array_new_with_free_func (g_free));
+
+      {
+        gpointer number_key = GetNumberKey (table, match->GetNumber ());
+
+        g_hash_table_insert (_numbers,
+                             number_key,
+                             match);
+        g_hash_table_insert (_match_numbers,
+                             match,
+                             number_key);
+      }
+
+      AddFencer (match, A);
+      AddFencer (match, B);
+
+      if (match->GetPiste ())
+      {
+        gchar *piste = g_strdup_printf ("p%d", match->GetPiste ());
+
+        AddWord (match,
+                 piste);
+        g_free (piste);
+      }
+    }
+  }
+
+  // --------------------------------------------------------------------------------
+  Match *MatchIndex::GetMatch (Table *table,
+                               gint   number)
+  {
+    return (Match *) g_hash_table_lookup (_numbers,
+                                          GetNumberKey (table, number));
+  }
+
+  // --------------------------------------------------------------------------------
+  GPtrArray *MatchIndex::Lookup (const gchar *text)
+  {
+    GPtrArray *matches    = nullptr;
+    gchar     *normalized = Normalize (text);
+
+    if (normalized[0])
+    {
+      if (strlen (normalized) > MAX_PREFIX_LENGTH)
+      {
+        normalized[MAX_PREFIX_LENGTH] = '\0';
+      }
+
+      matches = (GPtrArray *) g_hash_table_lookup (_prefixes,
+                                                   normalized);
+    }
+
+    g_free (normalized);
+
+    return matches;
+  }
+}
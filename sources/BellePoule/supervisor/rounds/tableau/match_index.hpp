@@ -0,0 +1,72 @@
+// Copyright (C) 2009 Yannick Le Roux.
+// This file is part of BellePoule.
+//
+//   BellePoule is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   BellePoule is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with BellePoule.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "util/object.hpp"
+
+class Match;
+class Player;
+
+namespace Table
+{
+  class Table;
+
+  class MatchIndex : public Object
+  {
+    public:
+      MatchIndex ();
+
+      void Clear ();
+
+      void Refresh (Match *match,
+                    Table *table);
+
+      void Remove (Match *match);
+
+      Match *GetMatch (Table *table,
+                       gint   number);
+
+      GPtrArray *Lookup (const gchar *text);
+
+    private:
+      static const guint MAX_PREFIX_LENGTH = 24;
+
+      GHashTable *_numbers;
+      GHashTable *_match_numbers;
+      GHashTable *_prefixes;
+      GHashTable *_match_keys;
+
+      ~MatchIndex () override;
+
+      void AddWord (Match       *match,
+                    const gchar *word);
+
+      void AddText (Match       *match,
+                    const gchar *text);
+
+      void AddFencer (Match  *match,
+                      Player *fencer);
+
+      static gboolean Contains (GPtrArray *matches,
+                                Match     *match);
+
+      static gchar *Normalize (const gchar *text);
+
+      static gpointer GetNumberKey (Table *table,
+                                    gint   number);
+  };
+}
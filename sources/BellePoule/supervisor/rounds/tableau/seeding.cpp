@@ -0,0 +1,124 @@
+// Copyright (C) 2009 Yannick Le Roux.
+// This file is part of BellePoule.
+//
+//   BellePoule is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   BellePoule is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with BellePoule.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "seeding.hpp"
+
+namespace Table
+{
+  // One level per power of two up to MAX_CACHED_SIZE, larger sizes on demand
+  guint *Seeding::_placements[32] = {nullptr};
+
+  // --------------------------------------------------------------------------------
+  guint Seeding::GetLevel (guint size)
+  {
+    guint level = 0;
+
+    while ((1U << level) < size)
+    {
+      level++;
+    }
+
+    return level;
+  }
+
+  // --------------------------------------------------------------------------------
+  const guint *Seeding::GetPlacement (guint size)
+  {
+    guint level = GetLevel (size);
+
+    if (_placements[0] == nullptr)
+    {
+      _placements[0] = g_new (guint, 1);
+      _placements[0][0] = 1;
+
+      for (guint l = 1; (1U << l) <= MAX_CACHED_SIZE; l++)
+      {
+        GetPlacement (1U << l);
+      }
+    }
+
+    if (_placements[level] == nullptr)
+    {
+      const guint *parent      = GetPlacement (1U << (level-1));
+      guint        parent_size = 1U << (level-1);
+      guint        child_size  = 1U << level;
+
+      _placements[level] = g_new (guint, child_size);
+
+      // The expected winner keeps the upper slot when its rank is odd
+      // and the lower one when it is even. The remaining slot goes to
+      // its mirror rank in the child table.
+      for (guint i = 0; i < parent_size; i++)
+      {
+        guint rank   = parent[i];
+        guint mirror = (child_size + 1) - rank;
+
+        if (rank % 2)
+        {
+          _placements[level][2*i]   = rank;
+          _placements[level][2*i+1] = mirror;
+        }
+        else
+        {
+          _placements[level][2*i]   = mirror;
+          _placements[level][2*i+1] = rank;
+        }
+      }
+    }
+
+    return _placements[level];
+  }
+
+  // --------------------------------------------------------------------------------
+  void **Seeding::Dispatch (GSList   *seeded_list,
+                            guint     size,
+                            gboolean  by_rank)
+  {
+    void **slots = g_new0 (void *, size);
+
+    if (by_rank)
+    {
+      const guint *placement = GetPlacement (size);
+      void       **seeds     = g_new0 (void *, size);
+      GSList      *current   = seeded_list;
+
+      for (guint i = 0; (i < size) && current; i++)
+      {
+        seeds[i] = current->data;
+        current  = g_slist_next (current);
+      }
+
+      for (guint i = 0; i < size; i++)
+      {
+        slots[i] = seeds[placement[i] - 1];
+      }
+
+      g_free (seeds);
+    }
+    else
+    {
+      GSList *current = seeded_list;
+
+      for (guint i = 0; (i < size) && current; i++)
+      {
+        slots[i] = current->data;
+        current  = g_slist_next (current);
+      }
+    }
+
+    return slots;
+  }
+}
@@ -0,0 +1,42 @@
+// Copyright (C) 2009 Yannick Le Roux.
+// This file is part of BellePoule.
+//
+//   BellePoule is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   BellePoule is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with BellePoule.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <gtk/gtk.h>
+
+namespace Table
+{
+  class Seeding
+  {
+    public:
+      static const guint MAX_CACHED_SIZE = 1024;
+
+      // Seed rank (starting at 1) expected at each slot of a table of the given size.
+      static const guint *GetPlacement (guint size);
+
+      // Spread the seeded list over the slots of a table of the given size.
+      // Unused slots are left to nullptr. The returned array is to be g_free'd.
+      static void **Dispatch (GSList   *seeded_list,
+                              guint     size,
+                              gboolean  by_rank);
+
+    private:
+      static guint *_placements[];
+
+      static guint GetLevel (guint size);
+  };
+}
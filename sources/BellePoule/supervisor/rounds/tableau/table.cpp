@@ -412,98 +412,89 @@ namespace Table
   // --------------------------------------------------------------------------------
   void Table::Load (xmlNode *xml_node)
   {
-    for (xmlNode *n = xml_node; n != nullptr; n = n->next)
+    if (_loaded)
     {
-      if (n->type == XML_ELEMENT_NODE)
-      {
-        if ((_loaded == FALSE) && (g_strcmp0 ((char *) n->name, "Tableau") == 0))
-        {
-          _loaded = TRUE;
+      return;
+    }
+    _loaded = TRUE;
 
-          {
-            gchar *attr = (gchar *) xmlGetProp (xml_node, BAD_CAST "NetID");
+    {
+      gchar *attr = (gchar *) xmlGetProp (xml_node, BAD_CAST "NetID");
 
-            if (attr)
-            {
-              _parcel->SetNetID (g_ascii_strtoull (attr,
-                                                   nullptr,
-                                                   16));
-              xmlFree (attr);
-            }
-          }
-        }
-        else if (g_strcmp0 ((char *) n->name, "Match") == 0)
-        {
-          gchar *number = nullptr;
+      if (attr)
+      {
+        _parcel->SetNetID (g_ascii_strtoull (attr,
+                                             nullptr,
+                                             16));
+        xmlFree (attr);
+      }
+    }
 
-          {
-            gchar *attr = (gchar *) xmlGetProp (n, BAD_CAST "ID");
+    {
+      Stage      *stage   = _table_set->GetStage ();
+      GHashTable *matches = g_hash_table_new (g_str_hash,
+                                              g_str_equal);
 
-            if (attr)
-            {
-              number = g_strdup_printf ("%d.%s", GetSize (), attr);
+      for (GSList *current = _match_list; current; current = g_slist_next (current))
+      {
+        Match       *match = (Match *) current->data;
+        const gchar *id    = strstr (match->GetName (), "-");
 
-              xmlFree (attr);
-            }
-          }
+        if (id)
+        {
+          g_hash_table_insert (matches,
+                               (gpointer) (id+1),
+                               match);
+        }
+      }
+
+      for (xmlNode *n = xml_node->children; n != nullptr; n = n->next)
+      {
+        if (   (n->type == XML_ELEMENT_NODE)
+            && (g_strcmp0 ((char *) n->name, "Match") == 0))
+        {
+          gchar *attr = (gchar *) xmlGetProp (n, BAD_CAST "ID");
 
-          if (number)
+          if (attr)
           {
-            GSList *current = _match_list;
-            guint   netid   = 0;
+            gchar *number = g_strdup_printf ("%d.%s", GetSize (), attr);
+            Match *match  = (Match *) g_hash_table_lookup (matches,
+                                                           number);
 
+            if (match)
             {
-              gchar *attr = (gchar *) xmlGetProp (n, BAD_CAST "NetID");
+              guint  netid = 0;
+              gchar *netid_attr = (gchar *) xmlGetProp (n, BAD_CAST "NetID");
 
-              if (attr)
+              if (netid_attr)
               {
-                netid = g_ascii_strtoull (attr,
+                netid = g_ascii_strtoull (netid_attr,
                                           nullptr,
                                           16);
-                xmlFree (attr);
+                xmlFree (netid_attr);
               }
-            }
 
-            while (current)
-            {
-              Match       *match = (Match *) current->data;
-              const gchar *id    = match->GetName ();
+              match->ChangeIdChain (_parcel->GetNetID (),
+                                    netid);
+
+              stage->LoadMatch (n,
+                                match);
 
-              id = strstr (id, "-");
-              if (id)
+              for (guint i = 0; i < 2; i++)
               {
-                id++;
-                if (g_strcmp0 (id, number) == 0)
-                {
-                  Stage *stage = _table_set->GetStage ();
-
-                  match->ChangeIdChain (_parcel->GetNetID (),
-                                        netid);
-
-                  stage->LoadMatch (n,
-                                    match);
-
-                  for (guint i = 0; i < 2; i++)
-                  {
-                    _table_set->SetPlayerToMatch (match,
-                                                  match->GetOpponent (i),
-                                                  i);
-                  }
-                  break;
-                }
+                _table_set->SetPlayerToMatch (match,
+                                              match->GetOpponent (i),
+                                              i);
               }
-              current = g_slist_next (current);
             }
 
             g_free (number);
+            xmlFree (attr);
           }
         }
-        else
-        {
-          return;
-        }
       }
-      Load (n->children);
+
+      g_hash_table_destroy (matches);
     }
   }
 
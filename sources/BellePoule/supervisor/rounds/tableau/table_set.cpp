@@ -46,6 +46,8 @@
 #include "table.hpp"
 #include "table_print_session.hpp"
 #include "sheet_compositor.hpp"
+#include "match_index.hpp"
+#include "seeding.hpp"
 
 #include "table_set.hpp"
 
@@ -92,6 +94,8 @@ namespace Table
     _loaded           = FALSE;
     _is_active        = FALSE;
     _html_table       = new HtmlTable (supervisor_module);
+    _match_index      = new MatchIndex ();
+    _seeded_slots     = nullptr;
     _from_table       = nullptr;
     _to_table         = nullptr;
     _last_search      = nullptr;
@@ -139,6 +143,7 @@ namespace Table
 
     _quick_search_treestore = GTK_TREE_STORE (_glade->GetGObject ("match_treestore"));
     _quick_search_filter    = GTK_TREE_MODEL_FILTER (_glade->GetGObject ("match_treemodelfilter"));
+    _quick_search_dirty     = TRUE;
 
     {
       gtk_cell_layout_set_cell_data_func (GTK_CELL_LAYOUT (_glade->GetWidget ("quick_search_combobox")),
@@ -191,6 +196,7 @@ namespace Table
     _right_filter->Release ();
 
     _html_table->Release ();
+    _match_index->Release ();
 
     _point_system->Reset ();
     _point_system->Release ();
@@ -287,6 +293,18 @@ namespace Table
     withdrawals = g_slist_sort_with_data (withdrawals,
                                           (GCompareDataFunc) TableSet::ComparePlayerZealously,
                                           this);
+
+    // Same input as the current tree: a new score upstream did not
+    // change who is coming down, so the bracket is kept as is.
+    if (   _tree_root
+        && Stage::SameOrder (attendees,   _attendees)
+        && Stage::SameOrder (withdrawals, _withdrawals))
+    {
+      g_slist_free (attendees);
+      g_slist_free (withdrawals);
+      return;
+    }
+
     g_slist_free (_withdrawals);
     _withdrawals = withdrawals;
 
@@ -603,43 +621,20 @@ namespace Table
   // --------------------------------------------------------------------------------
   void TableSet::Load (xmlNode *xml_node)
   {
-    LoadNode (xml_node);
-
-    SpreadWinners ();
-    RefreshTableStatus (TRUE);
-
-    for (guint t = 1; t < _nb_tables; t++)
-    {
-      Table *table = _tables[t];
-
-      if (table->_is_over)
-      {
-        _supervisor->OnTableOver (this,
-                                  table);
-      }
-    }
-  }
-
-  // --------------------------------------------------------------------------------
-  void TableSet::LoadNode (xmlNode *xml_node)
-  {
-    for (xmlNode *n = xml_node; n != nullptr; n = n->next)
+    if (_loaded == FALSE)
     {
-      static Table *table = nullptr;
+      _loaded = TRUE;
 
-      if (n->type == XML_ELEMENT_NODE)
+      for (xmlNode *n = xml_node->children; n != nullptr; n = n->next)
       {
-        if ((_loaded == FALSE) && (g_strcmp0 ((char *) n->name, "SuiteDeTableaux") == 0))
-        {
-          _loaded = TRUE;
-        }
-        else if (g_strcmp0 ((char *) n->name, "Tableau") == 0)
+        if (   (n->type == XML_ELEMENT_NODE)
+            && (g_strcmp0 ((char *) n->name, "Tableau") == 0))
         {
           gchar *prop = (gchar *) xmlGetProp (n, BAD_CAST "Taille");
 
           if (prop)
           {
-            table = GetTable (atoi (prop));
+            Table *table = GetTable (atoi (prop));
 
             if (table)
             {
@@ -649,12 +644,21 @@ namespace Table
             xmlFree (prop);
           }
         }
-        else
-        {
-          return;
-        }
       }
-      LoadNode (n->children);
+    }
+
+    SpreadWinners ();
+    RefreshTableStatus (TRUE);
+
+    for (guint t = 1; t < _nb_tables; t++)
+    {
+      Table *table = _tables[t];
+
+      if (table->_is_over)
+      {
+        _supervisor->OnTableOver (this,
+                                  table);
+      }
     }
   }
 
@@ -705,6 +709,30 @@ namespace Table
                              Match          *match,
                              Player         *player)
   {
+    // Scores replayed from a message are not new
+    if (score_collector)
+    {
+      GtkTreePath *path = (GtkTreePath *) match->GetPtrData (this, "quick_search_path");
+
+      if (path)
+      {
+        Contest      *contest = _supervisor->GetContest ();
+        Net::Message *record  = new Net::Message ("SmartPoule::Score");
+        gchar        *bout    = gtk_tree_path_to_string (path);
+
+        record->Set ("competition", contest->GetNetID ());
+        record->Set ("stage",       _supervisor->GetNetID ());
+        record->Set ("batch",       _id);
+        record->Set ("bout",        bout);
+        match->FeedScoreRecord (record);
+
+        Journalize (record);
+
+        record->Release ();
+        g_free (bout);
+      }
+    }
+
     match->Timestamp ();
 
     if (score_collector == _quick_score_collector)
@@ -741,6 +769,8 @@ namespace Table
   // --------------------------------------------------------------------------------
   void TableSet::DeleteTree ()
   {
+    _match_index->Clear ();
+
     if (_tree_root)
     {
       g_node_traverse (_tree_root,
@@ -785,6 +815,7 @@ namespace Table
     _nb_tables++;
 
     gtk_tree_store_clear (_quick_search_treestore);
+    _quick_search_dirty = TRUE;
 
     _tables = g_new (Table *, _nb_tables);
     for (guint t = 0; t < _nb_tables; t++)
@@ -831,7 +862,12 @@ namespace Table
       }
     }
 
+    _seeded_slots = Seeding::Dispatch (_attendees,
+                                       _tables[_nb_tables-1]->GetSize (),
+                                       _first_place == 1);
     AddFork (nullptr);
+    g_free (_seeded_slots);
+    _seeded_slots = nullptr;
 
     _html_table->Prepare (_nb_tables);
 
@@ -865,29 +901,34 @@ namespace Table
   // --------------------------------------------------------------------------------
   void TableSet::DumpToHTML (FILE *file)
   {
-    fprintf (file, "        <div>\n");
-    fprintf (file, "          <table class=\"TableTable\">\n");
+    GString *html = g_string_sized_new (4096);
+
+    g_string_append (html, "        <div>\n");
+    g_string_append (html, "          <table class=\"TableTable\">\n");
 
-    fprintf (file, "            <tr class=\"TableName\">\n");
+    g_string_append (html, "            <tr class=\"TableName\">\n");
     for (gint t = _nb_tables-1; t >= 0; t--)
     {
       Table *table      = _tables[t];
       gchar *tabel_name = table->GetImage ();
 
-      fprintf (file, "              <th>%s</th>\n", tabel_name);
+      g_string_append_printf (html, "              <th>%s</th>\n", tabel_name);
 
       g_free (tabel_name);
     }
-    fprintf (file, "            </tr>\n");
+    g_string_append (html, "            </tr>\n");
 
-    fprintf (file, "            <tr>\n");
-    fprintf (file, "              <th></th>\n");
-    fprintf (file, "            </tr>\n");
+    g_string_append (html, "            <tr>\n");
+    g_string_append (html, "              <th></th>\n");
+    g_string_append (html, "            </tr>\n");
 
-    _html_table->DumpToHTML (file);
+    _html_table->DumpToHTML (html);
 
-    fprintf (file, "          </table>\n");
-    fprintf (file, "        </div>\n");
+    g_string_append (html, "          </table>\n");
+    g_string_append (html, "        </div>\n");
+
+    fwrite (html->str, 1, html->len, file);
+    g_string_free (html, TRUE);
   }
 
   // --------------------------------------------------------------------------------
@@ -1607,13 +1648,10 @@ namespace Table
         data->_table_index = to_data->_table_index*2 + 1;
       }
 
-      if (g_node_n_children (to) != (to_data->_expected_winner_rank % 2))
-      {
-        data->_expected_winner_rank = to_data->_expected_winner_rank;
-      }
-      else
       {
-        data->_expected_winner_rank = (data->_table->GetSize () + 1) - to_data->_expected_winner_rank;
+        const guint *placement = Seeding::GetPlacement (data->_table->GetSize ());
+
+        data->_expected_winner_rank = placement[data->_table_index];
       }
 
       node = g_node_append_data (to, data);
@@ -1717,18 +1755,7 @@ namespace Table
     }
     else
     {
-      Player *player;
-
-      if (_first_place == 1)
-      {
-        player = (Player *) g_slist_nth_data (_attendees,
-                                              data->_expected_winner_rank - 1);
-      }
-      else
-      {
-        player = (Player *) g_slist_nth_data (_attendees,
-                                              data->_table_index);
-      }
+      Player *player = (Player *) _seeded_slots[data->_table_index];
 
       if (player)
       {
@@ -1769,6 +1796,8 @@ namespace Table
         left_table->DropMatch (data->_match);
       }
 
+      _match_index->Remove (data->_match);
+
       {
         TableZone *zone = (TableZone *) data->_match->GetPtrData (this,
                                                                   "table_zone");
@@ -2076,6 +2105,7 @@ namespace Table
             match->SetStartTime    (new FieTime (start_date, start_time));
             match->SetDurationSpan (message->GetInteger ("duration_span"));
             match->SetPiste        (message->GetInteger ("piste"));
+            _match_index->Refresh  (match, table);
 
             g_free (start_date);
             g_free (start_time);
@@ -2093,6 +2123,7 @@ namespace Table
             match->SetPiste (0);
             match->SetStartTime (nullptr);
             match->RemoveAllReferees ();
+            _match_index->Refresh (match, table);
           }
 
           return TRUE;
@@ -2348,6 +2379,8 @@ namespace Table
     {
       to_match->RemoveOpponent (1);
     }
+
+    _match_index->Remove (to_match);
   }
 
   // --------------------------------------------------------------------------------
@@ -2415,6 +2448,18 @@ namespace Table
 
         g_free (A_name);
         g_free (B_name);
+
+        _quick_search_dirty = TRUE;
+      }
+    }
+
+    {
+      Table *table = (Table *) to_match->GetPtrData (this, "table");
+
+      if (table)
+      {
+        _match_index->Refresh (to_match,
+                               table);
       }
     }
   }
@@ -2424,6 +2469,12 @@ namespace Table
   {
     GtkComboBox *combobox = GTK_COMBO_BOX (_glade->GetWidget ("quick_search_combobox"));
 
+    if (_quick_search_dirty == FALSE)
+    {
+      return;
+    }
+    _quick_search_dirty = FALSE;
+
     g_object_ref (_quick_search_filter);
 
     gtk_combo_box_set_model (combobox, nullptr);
@@ -2702,50 +2753,76 @@ namespace Table
   }
 
   // --------------------------------------------------------------------------------
-  gboolean TableSet::OnGotoMatch (gint number)
+  gboolean TableSet::SelectQuickSearchMatch (Match *match)
   {
-    gboolean found = FALSE;
+    GtkTreePath *path = (GtkTreePath *) match->GetPtrData (this,
+                                                           "quick_search_path");
+    GtkTreeIter  iter;
+
+    RefilterQuickSearch ();
 
+    if (   path
+        && gtk_tree_model_get_iter (GTK_TREE_MODEL (_quick_search_treestore),
+                                    &iter,
+                                    path))
+    {
+      GtkTreeIter filter_iter;
+
+      if (gtk_tree_model_filter_convert_child_iter_to_iter (_quick_search_filter,
+                                                            &filter_iter,
+                                                            &iter))
+      {
+        gtk_combo_box_set_active_iter (GTK_COMBO_BOX (_glade->GetWidget ("quick_search_combobox")),
+                                       &filter_iter);
+        return TRUE;
+      }
+    }
+
+    return FALSE;
+  }
+
+  // --------------------------------------------------------------------------------
+  gboolean TableSet::OnGotoMatch (gint number)
+  {
     if (_from_table)
     {
-      GtkTreeIter  parent;
-      GtkTreePath *path = gtk_tree_path_new_from_indices (_from_table->GetNumber (),
-                                                          -1);
+      Match *match = _match_index->GetMatch (_from_table,
+                                             number);
 
-      if (gtk_tree_model_get_iter (GTK_TREE_MODEL (_quick_search_filter),
-                                   &parent,
-                                   path))
+      if (match)
       {
-        GtkTreeIter iter;
-        gboolean     iter_is_valid = gtk_tree_model_iter_children (GTK_TREE_MODEL (_quick_search_filter),
-                                                                   &iter,
-                                                                   &parent);
-        while (iter_is_valid)
-        {
-          Match *match;
+        return SelectQuickSearchMatch (match);
+      }
+    }
 
-          gtk_tree_model_get (GTK_TREE_MODEL (_quick_search_filter),
-                              &iter,
-                              QuickMatchSearchColumnId::MATCH_ptr, &match,
-                              -1);
+    return FALSE;
+  }
 
-          if (match->GetNumber () == number)
-          {
-            found = TRUE;
-            gtk_combo_box_set_active_iter (GTK_COMBO_BOX (_glade->GetWidget ("quick_search_combobox")),
-                                           &iter);
-            break;
-          }
+  // --------------------------------------------------------------------------------
+  gboolean TableSet::OnSearchFencer (const gchar *text)
+  {
+    GPtrArray *matches = _match_index->Lookup (text);
 
-          iter_is_valid = gtk_tree_model_iter_next (GTK_TREE_MODEL (_quick_search_filter),
-                                                    &iter);
+    if (matches && matches->len)
+    {
+      Match *found = (Match *) g_ptr_array_index (matches, 0);
+
+      // Bouts still to be fenced first
+      for (guint i = 0; i < matches->len; i++)
+      {
+        Match *match = (Match *) g_ptr_array_index (matches, i);
+
+        if (match->IsOver () == FALSE)
+        {
+          found = match;
+          break;
         }
       }
 
-      gtk_tree_path_free (path);
+      return SelectQuickSearchMatch (found);
     }
 
-    return found;
+    return FALSE;
   }
 
   // --------------------------------------------------------------------------------
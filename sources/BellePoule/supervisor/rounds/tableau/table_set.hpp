@@ -40,6 +40,7 @@ namespace Table
   class Supervisor;
   class Table;
   class HtmlTable;
+  class MatchIndex;
   class PrintSession;
   class SheetCompositor;
 
@@ -90,6 +91,8 @@ namespace Table
 
       gboolean OnGotoMatch (gint number);
 
+      gboolean OnSearchFencer (const gchar *text);
+
       void OnPrint ();
 
       void OnPrintScoreSheets (Table *table = NULL);
@@ -174,6 +177,8 @@ namespace Table
       guint                  _nb_tables;
       GtkTreeStore          *_quick_search_treestore;
       GtkTreeModelFilter    *_quick_search_filter;
+      gboolean               _quick_search_dirty;
+      MatchIndex            *_match_index;
       GooCanvasItem         *_main_table;
       GooCanvasItem         *_quick_score_A;
       GooCanvasItem         *_quick_score_B;
@@ -196,6 +201,7 @@ namespace Table
       Table                 *_from_table;
       Table                 *_to_table;
       gboolean              *_row_filled;
+      void                 **_seeded_slots;
       HtmlTable             *_html_table;
       GdkPixbuf             *_printer_pixbuf;
       Filter                *_right_filter;
@@ -221,8 +227,6 @@ namespace Table
 
       Table *GetTable (guint size);
 
-      void LoadNode (xmlNode *xml_node);
-
       void OnStatusChanged (GtkComboBox *combo_box);
 
       void DrawPlayerMatch (GooCanvasItem *table,
@@ -367,6 +371,8 @@ namespace Table
 
       void RefilterQuickSearch ();
 
+      gboolean SelectQuickSearchMatch (Match *match);
+
       static gboolean SpreadWinner (GNode    *node,
                                     TableSet *table_set);
 
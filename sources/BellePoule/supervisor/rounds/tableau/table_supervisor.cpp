@@ -1296,11 +1296,22 @@ namespace Table
 
       if (text && text[0])
       {
-        gint number = (gint) g_ascii_strtoll (text,
-                                              nullptr,
-                                              10);
+        gchar    *end;
+        gboolean  found;
+        gint      number = (gint) g_ascii_strtoll (text,
+                                                   &end,
+                                                   10);
 
-        if (_displayed_table_set->OnGotoMatch (number) == FALSE)
+        if (*end == '\0')
+        {
+          found = _displayed_table_set->OnGotoMatch (number);
+        }
+        else
+        {
+          found = _displayed_table_set->OnSearchFencer (text);
+        }
+
+        if (found == FALSE)
         {
           GdkColor *color = g_new (GdkColor, 1);
 
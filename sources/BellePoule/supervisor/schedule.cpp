@@ -54,8 +54,10 @@ Schedule::Schedule (Contest *contest,
   : Object ("Schedule"),
     Module ("schedule.glade", "schedule_notebook")
 {
-   _stage_list    = nullptr;
-   _current_stage = 0;
+   _stage_list        = nullptr;
+   _stage_routes      = nullptr;
+   _unrouted_messages = 0;
+   _current_stage     = 0;
    _contest       = contest;
    _advertisers   = advertisers;
 
@@ -115,6 +117,8 @@ Schedule::~Schedule ()
     stage->Release ();
   }
   g_list_free (_stage_list);
+
+  DropRoutes ();
 }
 
 // --------------------------------------------------------------------------------
@@ -448,6 +452,7 @@ void Schedule::InsertStage (Stage *stage,
   else
   {
     stage->SetScoreStuffingPolicy (_score_stuffing_allowed);
+    DropRoutes ();
 
     // Insert it in the global list
     {
@@ -600,6 +605,7 @@ void Schedule::RemoveStage (Stage *stage)
 
       _stage_list = g_list_remove (_stage_list,
                                    stage);
+      DropRoutes ();
 
       RemoveFromNotebook (stage);
 
@@ -732,39 +738,91 @@ void Schedule::RemoveFromNotebook (Stage *stage)
 }
 
 // --------------------------------------------------------------------------------
-gboolean Schedule::OnMessage (Net::Message *message)
+void Schedule::DropRoutes ()
 {
-  for (GList *s = _stage_list; s; s = g_list_next (s))
+  if (_stage_routes)
   {
-    Stage *stage = (Stage *) s->data;
+    g_hash_table_destroy (_stage_routes);
+    _stage_routes = nullptr;
+  }
+}
+
+// --------------------------------------------------------------------------------
+Stage *Schedule::GetRoute (guint netid)
+{
+  Stage *stage = nullptr;
+
+  if (_stage_routes)
+  {
+    stage = (Stage *) g_hash_table_lookup (_stage_routes,
+                                           GUINT_TO_POINTER (netid));
+  }
 
-    if (stage->GetId () > _current_stage)
+  // NetIDs can be reassigned (load, duplicated parcels...).
+  // On a miss or a stale entry the table is built again.
+  if ((stage == nullptr) || (stage->GetNetID () != netid))
+  {
+    DropRoutes ();
+
+    _stage_routes = g_hash_table_new (nullptr,
+                                      nullptr);
+
+    for (GList *s = _stage_list; s; s = g_list_next (s))
     {
-      break;
+      Stage *current = (Stage *) s->data;
+      guint  id      = current->GetNetID ();
+
+      if (id)
+      {
+        g_hash_table_insert (_stage_routes,
+                             GUINT_TO_POINTER (id),
+                             current);
+      }
     }
 
-    if (message->HasField ("stage"))
+    stage = (Stage *) g_hash_table_lookup (_stage_routes,
+                                           GUINT_TO_POINTER (netid));
+  }
+
+  return stage;
+}
+
+// --------------------------------------------------------------------------------
+gboolean Schedule::OnMessage (Net::Message *message)
+{
+  if (message->HasField ("stage"))
+  {
+    Stage *stage = GetRoute (message->GetInteger ("stage"));
+
+    if (stage && (stage->GetId () <= _current_stage))
     {
-      if (stage->GetNetID () == message->GetInteger ("stage"))
+      if (message->Is ("SmartPoule::Score"))
       {
-        if (message->Is ("SmartPoule::Score"))
+        if (stage->GetInputProviderClient ())
         {
-          if (stage->GetInputProviderClient ())
-          {
-            stage = stage->GetNextStage ();
-          }
-
-          if (stage->Locked ())
-          {
-            return FALSE;
-          }
+          stage = stage->GetNextStage ();
         }
 
-        return stage->OnMessage (message);
+        if (stage->Locked ())
+        {
+          return FALSE;
+        }
       }
+
+      return stage->OnMessage (message);
     }
-    else
+  }
+  else
+  {
+    for (GList *s = _stage_list; s; s = g_list_next (s))
     {
+      Stage *stage = (Stage *) s->data;
+
+      if (stage->GetId () > _current_stage)
+      {
+        break;
+      }
+
       if (stage->OnMessage (message))
       {
         return TRUE;
@@ -772,6 +830,12 @@ gboolean Schedule::OnMessage (Net::Message *message)
     }
   }
 
+  _unrouted_messages++;
+#ifdef DEBUG
+  printf ("Schedule::OnMessage: %d unrouted message(s)\n", _unrouted_messages);
+  message->Log ();
+#endif
+
   return FALSE;
 }
 
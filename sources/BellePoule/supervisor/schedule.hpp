@@ -103,6 +103,8 @@ class Schedule : public Module,
     GtkListStore       *_list_store;
     GtkTreeModelFilter *_list_store_filter;
     GList              *_stage_list;
+    GHashTable         *_stage_routes;
+    guint               _unrouted_messages;
     guint               _current_stage;
     gboolean            _score_stuffing_allowed;
     Contest            *_contest;
@@ -131,6 +133,10 @@ class Schedule : public Module,
 
     Stage *GetStage (guint index);
 
+    Stage *GetRoute (guint netid);
+
+    void DropRoutes ();
+
     void LoadPeoples (Stage           *stage_host,
                       xmlXPathContext *xml_context,
                       const gchar     *contest_keyword);
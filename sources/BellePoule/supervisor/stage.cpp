@@ -52,6 +52,7 @@ Stage::Stage (StageClass *stage_class)
   _classification    = nullptr;
   _input_provider    = nullptr;
   _classification_on = FALSE;
+  _output_ref_index  = nullptr;
 
   _score_stuffing_trigger = nullptr;
 
@@ -68,6 +69,7 @@ Stage::Stage (StageClass *stage_class)
 Stage::~Stage ()
 {
   FreeResult ();
+  DropOutputRefIndex ();
   g_free (_name);
 
   TryToRelease (_score_stuffing_trigger);
@@ -213,6 +215,8 @@ void Stage::FreeResult ()
   g_slist_free (_output_short_list);
   _output_short_list = nullptr;
   _quota_exceedance  = 0;
+
+  DropOutputRefIndex ();
 }
 
 // --------------------------------------------------------------------------------
@@ -479,64 +483,57 @@ guint Stage::GetQuotaExceedance ()
 // --------------------------------------------------------------------------------
 void Stage::SetOutputShortlist ()
 {
+  DropOutputRefIndex ();
+
   if (_output_short_list)
   {
     g_slist_free (_output_short_list);
     _output_short_list = nullptr;
   }
 
-  if (_result)
+  if (_result && (_classification == nullptr))
   {
     _output_short_list = g_slist_copy (_result);
   }
-
-  if (_output_short_list && _classification)
+  else if (_result)
   {
-    Player::AttributeId classif_attr_id       ("status", GetPlayerDataOwner ());
-    Player::AttributeId global_status_attr_id ("global_status");
+    Player::AttributeId  classif_attr_id       ("status", GetPlayerDataOwner ());
+    Player::AttributeId  global_status_attr_id ("global_status");
+    GSList              *reversed_short_list = nullptr;
+
+    // The short list is built backward in a single pass so that the
+    // fencers dropped below are always taken from its head.
 
     // Remove all of the withdrawalls and black cards
+    for (GSList *current = _result; current; current = g_slist_next (current))
     {
-      Player::AttributeId stage_status_attr_id ("status", GetPlayerDataOwner ());
-      GSList *new_short_list = nullptr;
-      GSList *current        = _output_short_list;
+      Player    *player            = (Player *) current->data;
+      Attribute *stage_status_attr = player->GetAttribute (&classif_attr_id);
 
-      while (current)
+      if (stage_status_attr)
       {
-        Player    *player            = (Player *) current->data;
-        Attribute *stage_status_attr = player->GetAttribute (&stage_status_attr_id);
+        gchar *value = stage_status_attr->GetStrValue ();
 
-        if (stage_status_attr)
+        if (value
+            && (value[0] != 'Q') && value[0] != 'N')
         {
-          gchar *value = stage_status_attr->GetStrValue ();
-
-          if (value
-              && (value[0] != 'Q') && value[0] != 'N')
-          {
-            player->SetAttributeValue (&global_status_attr_id,
-                                       value);
-          }
-          else
-          {
-            new_short_list = g_slist_append (new_short_list, player);
-          }
+          player->SetAttributeValue (&global_status_attr_id,
+                                     value);
+        }
+        else
+        {
+          reversed_short_list = g_slist_prepend (reversed_short_list, player);
         }
-
-        current = g_slist_next (current);
       }
-
-      g_slist_free (_output_short_list);
-      _output_short_list = new_short_list;
     }
 
     // Remove all of the fencers not promoted in the barrage round
     {
       Player::AttributeId promoted_attr_id ("promoted", GetPlayerDataOwner ());
-      GSList *current = g_slist_last (_output_short_list);
 
-      while (current)
+      while (reversed_short_list)
       {
-        Player    *player   = (Player *) current->data;
+        Player    *player   = (Player *) reversed_short_list->data;
         Attribute *promoted = player->GetAttribute (&promoted_attr_id);
 
         if (promoted && (promoted->GetUIntValue () == FALSE))
@@ -546,32 +543,36 @@ void Stage::SetOutputShortlist ()
           player->SetAttributeValue (&global_status_attr_id,
                                      "N");
 
-          _output_short_list = g_slist_delete_link (_output_short_list,
-                                                    current);
+          reversed_short_list = g_slist_delete_link (reversed_short_list,
+                                                     reversed_short_list);
         }
         else
         {
           break;
         }
-
-        current = g_slist_last (_output_short_list);
       }
     }
 
     // Quota
     if (_nb_qualified->IsValid () && (_nb_qualified->GetValue () > 0))
     {
-      Player *last_qualified = (Player *) g_slist_nth_data (_output_short_list, _nb_qualified->GetValue ()-1);
+      guint   nb_qualified   = _nb_qualified->GetValue ();
+      guint   length         = g_slist_length (reversed_short_list);
+      Player *last_qualified = nullptr;
+
+      if (nb_qualified <= length)
+      {
+        last_qualified = (Player *) g_slist_nth_data (reversed_short_list, length - nb_qualified);
+      }
 
       if (last_qualified)
       {
         Player::AttributeId  rank_attr_id ("rank", this);
         Attribute           *last_qualified_rank = last_qualified->GetAttribute (&rank_attr_id);
-        GSList              *current             = g_slist_last (_output_short_list);
 
-        while (current)
+        while (reversed_short_list)
         {
-          Player    *player = (Player *) current->data;
+          Player    *player = (Player *) reversed_short_list->data;
           Attribute *rank   = player->GetAttribute (&rank_attr_id);
 
           if (rank->GetUIntValue () <= last_qualified_rank->GetUIntValue ())
@@ -580,8 +581,7 @@ void Stage::SetOutputShortlist ()
           }
 
           {
-            Player::AttributeId stage_attr_id ("status", GetPlayerDataOwner ());
-            Attribute *stage_status_attr = player->GetAttribute (&stage_attr_id);
+            Attribute *stage_status_attr = player->GetAttribute (&classif_attr_id);
 
             if (stage_status_attr)
             {
@@ -597,45 +597,41 @@ void Stage::SetOutputShortlist ()
             }
           }
 
-          _output_short_list = g_slist_delete_link (_output_short_list,
-                                                    current);
-          current = g_slist_last (_output_short_list);
+          reversed_short_list = g_slist_delete_link (reversed_short_list,
+                                                     reversed_short_list);
+          length--;
         }
       }
 
       // Quota exceedance
-      if (g_slist_length (_output_short_list) > _nb_qualified->GetValue ())
+      if (length > nb_qualified)
       {
-        GSList *reversed_short_list = g_slist_copy (_output_short_list);
+        GSList              *current = reversed_short_list;
+        Player::AttributeId  rank_attr_id ("rank", this);
+        Attribute           *last_qualified_rank = nullptr;
 
-        reversed_short_list = g_slist_reverse (reversed_short_list);
+        _quota_exceedance = length;
+        for (guint i = 0; current != nullptr; i++)
         {
-          GSList              *current = reversed_short_list;
-          Player::AttributeId  rank_attr_id ("rank", this);
-          Attribute           *last_qualified_rank = nullptr;
+          Player    *current_fencer = (Player *) current->data;
+          Attribute *current_rank   = current_fencer->GetAttribute (&rank_attr_id);
 
-          _quota_exceedance = g_slist_length (_output_short_list);
-          for (guint i = 0; current != nullptr; i++)
+          if (last_qualified_rank == nullptr)
           {
-            Player    *current_fencer = (Player *) current->data;
-            Attribute *current_rank   = current_fencer->GetAttribute (&rank_attr_id);
-
-            if (last_qualified_rank == nullptr)
-            {
-              last_qualified_rank = current_rank;
-            }
-            else if (current_rank->GetUIntValue () < last_qualified_rank->GetUIntValue ())
-            {
-              _quota_exceedance = i;
-              break;
-            }
-
-            current = g_slist_next (current);
+            last_qualified_rank = current_rank;
+          }
+          else if (current_rank->GetUIntValue () < last_qualified_rank->GetUIntValue ())
+          {
+            _quota_exceedance = i;
+            break;
           }
+
+          current = g_slist_next (current);
         }
-        g_slist_free (reversed_short_list);
       }
     }
+
+    _output_short_list = g_slist_reverse (reversed_short_list);
   }
 }
 
@@ -754,17 +750,50 @@ void Stage::DeactivateNbQualified ()
 // --------------------------------------------------------------------------------
 Player *Stage::GetFencerFromRef (guint ref)
 {
-  for (GSList *current = GetShortList (); current; current = g_slist_next (current))
+  if (_previous && (_previous->_locked == TRUE))
   {
-    Player *player = (Player *) current->data;
+    return _previous->GetOutputFencer (ref);
+  }
 
-    if (player->GetRef () == ref)
+  return nullptr;
+}
+
+// --------------------------------------------------------------------------------
+Player *Stage::GetOutputFencer (guint ref)
+{
+  // Built on demand and shared by every lookup of the next stage
+  // until the output short list is computed again.
+  if (_output_ref_index == nullptr)
+  {
+    _output_ref_index = g_hash_table_new (nullptr,
+                                          nullptr);
+
+    for (GSList *current = _output_short_list; current; current = g_slist_next (current))
     {
-      return player;
+      Player   *player = (Player *) current->data;
+      gpointer  key    = GUINT_TO_POINTER (player->GetRef ());
+
+      if (g_hash_table_lookup (_output_ref_index, key) == nullptr)
+      {
+        g_hash_table_insert (_output_ref_index,
+                             key,
+                             player);
+      }
     }
   }
 
-  return nullptr;
+  return (Player *) g_hash_table_lookup (_output_ref_index,
+                                         GUINT_TO_POINTER (ref));
+}
+
+// --------------------------------------------------------------------------------
+void Stage::DropOutputRefIndex ()
+{
+  if (_output_ref_index)
+  {
+    g_hash_table_destroy (_output_ref_index);
+    _output_ref_index = nullptr;
+  }
 }
 
 // --------------------------------------------------------------------------------
@@ -1130,7 +1159,15 @@ void Stage::UpdateClassification (Classification *classification,
       previous_attr_id = new Player::AttributeId ("rank", _previous);
     }
 
-    classification->Wipe ();
+    // Same fencers in the same order: the rows only need their
+    // values to be refreshed, the list itself is kept as is.
+    gboolean unchanged = SameOrder (result,
+                                    classification->GetList ());
+
+    if (unchanged == FALSE)
+    {
+      classification->Wipe ();
+    }
 
     {
       Player::AttributeId *rank_attr_id   = new Player::AttributeId ("rank", this);
@@ -1152,7 +1189,14 @@ void Stage::UpdateClassification (Classification *classification,
           }
         }
 
-        classification->Add (player);
+        if (unchanged)
+        {
+          classification->Update (player);
+        }
+        else
+        {
+          classification->Add (player);
+        }
 
         current_player = g_slist_next (current_player);
       }
@@ -191,6 +191,24 @@ class Stage : public virtual Object,
 
     static Stage *CreateInstance (const gchar *name);
 
+    // Same fencers in the same order (GList or GSList on either side)
+    template <typename ListA, typename ListB>
+    static gboolean SameOrder (ListA *a,
+                               ListB *b)
+    {
+      while (a && b)
+      {
+        if (a->data != b->data)
+        {
+          return FALSE;
+        }
+        a = a->next;
+        b = b->next;
+      }
+
+      return ((a == nullptr) && (b == nullptr));
+    }
+
     void LoadMatch (xmlNode *xml_node,
                     Match   *match);
 
@@ -246,11 +264,14 @@ class Stage : public virtual Object,
     SensitivityTrigger *_score_stuffing_trigger;
     gboolean            _classification_on;
     guint32             _anti_cheat_token;
+    GHashTable         *_output_ref_index;
 
     Listener *_status_listener;
 
     void SetResult ();
     void FreeResult ();
+    Player *GetOutputFencer (guint ref);
+    void DropOutputRefIndex ();
     virtual void OnLocked () {};
     virtual void OnUnLocked () {};
     static StageClass *GetClass (const gchar *name);
@@ -907,8 +907,25 @@ void Tournament::OpenUriContest (const gchar *uri)
       }
 
       g_free (dirname);
-      askfred->Release ();
 
+      if (askfred->GetError ())
+      {
+        GtkWidget *dialog;
+
+        dialog = gtk_message_dialog_new (nullptr,
+                                         GTK_DIALOG_DESTROY_WITH_PARENT,
+                                         GTK_MESSAGE_ERROR,
+                                         GTK_BUTTONS_OK,
+                                         "AskFred import failed");
+
+        gtk_message_dialog_format_secondary_text (GTK_MESSAGE_DIALOG (dialog),
+                                                  "%s",
+                                                  askfred->GetError ());
+
+        RunDialog (GTK_DIALOG (dialog));
+        gtk_widget_destroy (dialog);
+      }
+      else
       {
         GtkWidget *dialog;
 
@@ -924,6 +941,8 @@ void Tournament::OpenUriContest (const gchar *uri)
         RunDialog (GTK_DIALOG (dialog));
         gtk_widget_destroy (dialog);
       }
+
+      askfred->Release ();
     }
     else if (g_str_has_suffix (uri,
                                ".zip"))
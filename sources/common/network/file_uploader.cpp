@@ -14,6 +14,7 @@
 //   You should have received a copy of the GNU General Public License
 //   along with BellePoule.  If not, see <http://www.gnu.org/licenses/>.
 
+#include "upload_ledger.hpp"
 #include "file_uploader.hpp"
 
 namespace Net
@@ -28,6 +29,10 @@ namespace Net
     _user      = g_strdup (user);
     _passwd    = g_strdup (passwd);
     _file_path = nullptr;
+    _content   = nullptr;
+    _uploaded  = FALSE;
+    _ledger    = nullptr;
+    _digest    = nullptr;
     _url       = g_strdup (url);
     _www       = g_strdup (url);
   }
@@ -40,8 +45,36 @@ namespace Net
     g_free (_passwd);
     g_free (_file_path);
     g_free (_full_url);
+
+    if (_content)
+    {
+      g_bytes_unref (_content);
+    }
     g_free (_url);
     g_free (_www);
+    g_free (_digest);
+
+    Object::TryToRelease (_ledger);
+  }
+
+  // --------------------------------------------------------------------------------
+  void FileUploader::SetContent (GBytes *content)
+  {
+    if (_content)
+    {
+      g_bytes_unref (_content);
+    }
+
+    _content = g_bytes_ref (content);
+  }
+
+  // --------------------------------------------------------------------------------
+  void FileUploader::SetLedger (UploadLedger *ledger)
+  {
+    Object::TryToRelease (_ledger);
+
+    _ledger = ledger;
+    _ledger->Retain ();
   }
 
   // --------------------------------------------------------------------------------
@@ -60,6 +93,21 @@ namespace Net
       g_free (base_name);
     }
 
+    // Nothing to send if the remote copy is already the same
+    if (_ledger && _content && _full_url)
+    {
+      _digest = g_compute_checksum_for_bytes (G_CHECKSUM_SHA1,
+                                              _content);
+
+      if (_ledger->IsUpToDate (_full_url, _digest))
+      {
+#ifdef DEBUG
+        printf ("FileUploader: %s unchanged\n", _full_url);
+#endif
+        return;
+      }
+    }
+
     Retain ();
 
     {
@@ -109,7 +157,15 @@ namespace Net
   // --------------------------------------------------------------------------------
   void FileUploader::Looper ()
   {
-    if (_file_path)
+    if (_content)
+    {
+      gsize        size;
+      const gchar *data = (const gchar *) g_bytes_get_data (_content, &size);
+
+      SetDataCopy (g_strndup (data, size));
+      _uploaded = (Upload () == CURLE_OK);
+    }
+    else if (_file_path)
     {
       GError *error = nullptr;
       gchar  *data_copy;
@@ -125,7 +181,7 @@ namespace Net
       else
       {
         SetDataCopy (data_copy);
-        Upload ();
+        _uploaded = (Upload () == CURLE_OK);
       }
     }
   }
@@ -144,6 +200,12 @@ namespace Net
   // --------------------------------------------------------------------------------
   gboolean FileUploader::OnThreadDone (FileUploader *uploader)
   {
+    if (uploader->_uploaded && uploader->_ledger && uploader->_digest)
+    {
+      uploader->_ledger->Record (uploader->_full_url,
+                                 uploader->_digest);
+    }
+
     uploader->Release ();
     return G_SOURCE_REMOVE;
   }
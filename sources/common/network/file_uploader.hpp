@@ -20,6 +20,8 @@
 
 namespace Net
 {
+  class UploadLedger;
+
   class FileUploader : public Uploader
   {
     public:
@@ -28,6 +30,10 @@ namespace Net
                     const gchar *passwd,
                     const gchar *www);
 
+      void SetContent (GBytes *content);
+
+      void SetLedger (UploadLedger *ledger);
+
       virtual void UploadFile (const gchar *file_path);
 
       ~FileUploader () override;
@@ -37,7 +43,9 @@ namespace Net
       const gchar *GetWWW ();
 
     protected:
-      gchar *_file_path;
+      gchar    *_file_path;
+      GBytes   *_content;
+      gboolean  _uploaded;
 
       virtual void Looper ();
 
@@ -48,6 +56,9 @@ namespace Net
       gchar *_url;
       gchar *_www;
 
+      UploadLedger *_ledger;
+      gchar        *_digest;
+
       void PushMessage (Message *message);
 
       const gchar *GetUrl () override;
@@ -102,7 +102,20 @@ namespace Net
     _form_head = nullptr;
     _form_tail = nullptr;
 
-    if (_current_job == 0)
+    if ((_current_job == 0) && _content)
+    {
+      gsize         size;
+      gconstpointer data = g_bytes_get_data (_content, &size);
+
+      curl_formadd (&_form_head,
+                    &_form_tail,
+                    CURLFORM_PTRNAME,      "ficXML",
+                    CURLFORM_BUFFER,       _remote_file,
+                    CURLFORM_BUFFERPTR,    data,
+                    CURLFORM_BUFFERLENGTH, (long) size,
+                    CURLFORM_END);
+    }
+    else if (_current_job == 0)
     {
 #ifdef G_OS_WIN32
       _local_file = g_win32_locale_filename_from_utf8 (_file_path);
@@ -136,9 +149,14 @@ namespace Net
   // --------------------------------------------------------------------------------
   void GregUploader::Looper ()
   {
+    _uploaded = TRUE;
+
     for (_current_job = 0; _current_job < JOB_COUNT; _current_job++)
     {
-      Upload ();
+      if (Upload () != CURLE_OK)
+      {
+        _uploaded = FALSE;
+      }
       curl_formfree (_form_head);
     }
   }
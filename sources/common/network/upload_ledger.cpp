@@ -0,0 +1,55 @@
+// Copyright (C) 2009 Yannick Le Roux.
+// This file is part of BellePoule.
+//
+//   BellePoule is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   BellePoule is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with BellePoule.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "upload_ledger.hpp"
+
+namespace Net
+{
+  // --------------------------------------------------------------------------------
+  UploadLedger::UploadLedger ()
+    : Object ("UploadLedger")
+  {
+    _digests = g_hash_table_new_full (g_str_hash,
+                                      g_str_equal,
+                                      g_free,
+                                      g_free);
+  }
+
+  // --------------------------------------------------------------------------------
+  UploadLedger::~UploadLedger ()
+  {
+    g_hash_table_destroy (_digests);
+  }
+
+  // --------------------------------------------------------------------------------
+  gboolean UploadLedger::IsUpToDate (const gchar *url,
+                                     const gchar *digest)
+  {
+    const gchar *last = (const gchar *) g_hash_table_lookup (_digests,
+                                                             url);
+
+    return (last && (g_strcmp0 (last, digest) == 0));
+  }
+
+  // --------------------------------------------------------------------------------
+  void UploadLedger::Record (const gchar *url,
+                             const gchar *digest)
+  {
+    g_hash_table_replace (_digests,
+                          g_strdup (url),
+                          g_strdup (digest));
+  }
+}
@@ -23,6 +23,7 @@
 
 GList                       *AttributeDesc::_list           = nullptr;
 GSList                      *AttributeDesc::_swappable_list = nullptr;
+GHashTable                  *AttributeDesc::_xml_index      = nullptr;
 AttributeDesc::CriteriaFunc  AttributeDesc::_criteria_func  = nullptr;
 
 // --------------------------------------------------------------------------------
@@ -119,12 +120,45 @@ AttributeDesc *AttributeDesc::Declare (GType        type,
   _list = g_list_append (_list,
                          attr_desc);
 
+  if (attr_desc->_xml_name)
+  {
+    GSList *homonyms;
+
+    if (_xml_index == nullptr)
+    {
+      _xml_index = g_hash_table_new_full (g_str_hash,
+                                          g_str_equal,
+                                          nullptr,
+                                          (GDestroyNotify) g_slist_free);
+    }
+
+    homonyms = (GSList *) g_hash_table_lookup (_xml_index,
+                                               attr_desc->_xml_name);
+    if (homonyms)
+    {
+      homonyms = g_slist_append (homonyms,
+                                 attr_desc);
+    }
+    else
+    {
+      g_hash_table_insert (_xml_index,
+                           attr_desc->_xml_name,
+                           g_slist_append (nullptr,
+                                           attr_desc));
+    }
+  }
+
   return attr_desc;
 }
 
 // --------------------------------------------------------------------------------
 void AttributeDesc::Cleanup ()
 {
+  if (_xml_index)
+  {
+    g_hash_table_destroy (_xml_index);
+    _xml_index = nullptr;
+  }
   FreeFullGList (AttributeDesc, _list);
 }
 
@@ -972,17 +1006,23 @@ AttributeDesc *AttributeDesc::GetDescFromCodeName (const gchar *code_name)
 // --------------------------------------------------------------------------------
 AttributeDesc *AttributeDesc::GetDescFromXmlName (const gchar *xml_name)
 {
-  GList *current = _list;
+  GSList *homonyms = GetDescListFromXmlName (xml_name);
 
-  while (current)
+  if (homonyms)
   {
-    AttributeDesc *attr_desc = (AttributeDesc *) current->data;
+    return (AttributeDesc *) homonyms->data;
+  }
 
-    if (g_strcmp0 (attr_desc->_xml_name, xml_name) == 0)
-    {
-      return attr_desc;
-    }
-    current = g_list_next (current);
+  return nullptr;
+}
+
+// --------------------------------------------------------------------------------
+GSList *AttributeDesc::GetDescListFromXmlName (const gchar *xml_name)
+{
+  if (_xml_index && xml_name)
+  {
+    return (GSList *) g_hash_table_lookup (_xml_index,
+                                           xml_name);
   }
 
   return nullptr;
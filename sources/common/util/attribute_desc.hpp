@@ -113,6 +113,8 @@ class AttributeDesc : public Object
 
     static AttributeDesc *GetDescFromXmlName (const gchar *xml_name);
 
+    static GSList *GetDescListFromXmlName (const gchar *xml_name);
+
     static AttributeDesc *GuessDescFromUserName (const gchar *code_name,
                                                  const gchar *criteria);
 
@@ -182,6 +184,7 @@ class AttributeDesc : public Object
   private:
     static GList        *_list;
     static GSList       *_swappable_list;
+    static GHashTable   *_xml_index;
     static CriteriaFunc  _criteria_func;
 
     AttributeDesc (GType        type,
@@ -0,0 +1,540 @@
+// Copyright (C) 2009 Yannick Le Roux.
+// This file is part of BellePoule.
+//
+//   BellePoule is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   BellePoule is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with BellePoule.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <stdio.h>
+#include <string.h>
+#include <glib/gstdio.h>
+#include <libxml/parser.h>
+
+#include "binary_snapshot.hpp"
+
+// File layout (integers are little endian)
+//
+//   magic         8 bytes
+//   version       4 bytes
+//   reserved      4 bytes
+//   xml size      8 bytes  \ stamp of the XML file
+//   xml mtime     8 bytes  /
+//   payload size  8 bytes
+//   payload md5  16 bytes
+//   payload:
+//     string count, then for each string its length, its bytes and a NUL
+//     root element
+//
+// Elements are coded as ELEMENT, name, attribute count, the (name, value)
+// pairs, the children and END. Text nodes are coded as TEXT, value. Apart
+// from the fixed header every number is a LEB128 varint and every string
+// a varint index into the string table.
+
+static const gchar MAGIC[8]    = {'B', 'P', 'S', 'N', 'A', 'P', '\0', '\0'};
+static const gsize HEADER_SIZE = 56;
+static const guint MAX_DEPTH   = 64;
+
+enum Opcode
+{
+  END,
+  ELEMENT,
+  TEXT
+};
+
+struct Decoder
+{
+  xmlDoc        *_doc;
+  const gchar  **_strings;
+  guint64        _string_count;
+  const guint8  *_cursor;
+  const guint8  *_end;
+};
+
+// --------------------------------------------------------------------------------
+static void PutVarint (GByteArray *array,
+                       guint64     value)
+{
+  do
+  {
+    guint8 byte = value & 0x7F;
+
+    value >>= 7;
+    if (value)
+    {
+      byte |= 0x80;
+    }
+    g_byte_array_append (array,
+                         &byte,
+                         1);
+  } while (value);
+}
+
+// --------------------------------------------------------------------------------
+static gboolean GetVarint (Decoder *decoder,
+                           guint64 *value)
+{
+  *value = 0;
+
+  for (guint shift = 0; (shift < 64) && (decoder->_cursor < decoder->_end); shift += 7)
+  {
+    guint8 byte = *decoder->_cursor;
+
+    decoder->_cursor++;
+    *value |= (guint64) (byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0)
+    {
+      return TRUE;
+    }
+  }
+
+  return FALSE;
+}
+
+// --------------------------------------------------------------------------------
+static void PutFixed (guint8  *where,
+                      guint64  value,
+                      guint    size)
+{
+  for (guint i = 0; i < size; i++)
+  {
+    where[i] = (guint8) (value >> (8*i));
+  }
+}
+
+// --------------------------------------------------------------------------------
+static guint64 GetFixed (const guint8 *where,
+                         guint         size)
+{
+  guint64 value = 0;
+
+  for (guint i = 0; i < size; i++)
+  {
+    value |= (guint64) where[i] << (8*i);
+  }
+
+  return value;
+}
+
+// --------------------------------------------------------------------------------
+static const gchar *GetString (Decoder *decoder)
+{
+  guint64 index;
+
+  if (GetVarint (decoder, &index) && (index < decoder->_string_count))
+  {
+    return decoder->_strings[index];
+  }
+
+  return nullptr;
+}
+
+// --------------------------------------------------------------------------------
+static xmlNode *DecodeElement (Decoder *decoder,
+                               guint    depth)
+{
+  const gchar *name = GetString (decoder);
+  guint64      attr_count;
+  xmlNode     *element;
+
+  if ((name == nullptr) || (depth > MAX_DEPTH) || (GetVarint (decoder, &attr_count) == FALSE))
+  {
+    return nullptr;
+  }
+
+  element = xmlNewDocNode (decoder->_doc,
+                           nullptr,
+                           BAD_CAST name,
+                           nullptr);
+
+  for (guint64 i = 0; i < attr_count; i++)
+  {
+    const gchar *attr_name  = GetString (decoder);
+    const gchar *attr_value = GetString (decoder);
+
+    if ((attr_name == nullptr) || (attr_value == nullptr))
+    {
+      xmlFreeNode (element);
+      return nullptr;
+    }
+
+    xmlNewProp (element,
+                BAD_CAST attr_name,
+                BAD_CAST attr_value);
+  }
+
+  while (TRUE)
+  {
+    guint64  opcode;
+    xmlNode *child = nullptr;
+
+    if (GetVarint (decoder, &opcode) == FALSE)
+    {
+      break;
+    }
+
+    if (opcode == END)
+    {
+      return element;
+    }
+    else if (opcode == ELEMENT)
+    {
+      child = DecodeElement (decoder,
+                             depth + 1);
+    }
+    else if (opcode == TEXT)
+    {
+      const gchar *value = GetString (decoder);
+
+      if (value)
+      {
+        child = xmlNewDocText (decoder->_doc,
+                               BAD_CAST value);
+      }
+    }
+
+    if (child == nullptr)
+    {
+      break;
+    }
+
+    xmlAddChild (element,
+                 child);
+  }
+
+  xmlFreeNode (element);
+  return nullptr;
+}
+
+// --------------------------------------------------------------------------------
+BinarySnapshot::BinarySnapshot ()
+  : Object ("BinarySnapshot")
+{
+  _index      = g_hash_table_new_full (g_str_hash,
+                                       g_str_equal,
+                                       g_free,
+                                       nullptr);
+  _strings    = g_ptr_array_new ();
+  _tree       = g_byte_array_new ();
+  _attributes = g_byte_array_new ();
+  _attr_count = 0;
+  _pending    = FALSE;
+  _elements   = 0;
+}
+
+// --------------------------------------------------------------------------------
+BinarySnapshot::~BinarySnapshot ()
+{
+  g_byte_array_free (_attributes,
+                     TRUE);
+  g_byte_array_free (_tree,
+                     TRUE);
+  g_ptr_array_free (_strings,
+                    TRUE);
+  g_hash_table_destroy (_index);
+}
+
+// --------------------------------------------------------------------------------
+void BinarySnapshot::PutString (GByteArray  *array,
+                                const gchar *string)
+{
+  gpointer index;
+
+  if (g_hash_table_lookup_extended (_index,
+                                    string,
+                                    nullptr,
+                                    &index) == FALSE)
+  {
+    gchar *key = g_strdup (string);
+
+    index = GUINT_TO_POINTER (_strings->len);
+    g_ptr_array_add (_strings,
+                     key);
+    g_hash_table_insert (_index,
+                         key,
+                         index);
+  }
+
+  PutVarint (array,
+             GPOINTER_TO_UINT (index));
+}
+
+// --------------------------------------------------------------------------------
+void BinarySnapshot::FlushPending ()
+{
+  // The attribute count comes before the attributes
+  if (_pending)
+  {
+    PutVarint (_tree,
+               _attr_count);
+    g_byte_array_append (_tree,
+                         _attributes->data,
+                         _attributes->len);
+
+    g_byte_array_set_size (_attributes,
+                           0);
+    _attr_count = 0;
+    _pending    = FALSE;
+  }
+}
+
+// --------------------------------------------------------------------------------
+void BinarySnapshot::StartElement (const gchar *name)
+{
+  FlushPending ();
+
+  PutVarint (_tree, ELEMENT);
+  PutString (_tree, name);
+
+  _pending = TRUE;
+  _elements++;
+}
+
+// --------------------------------------------------------------------------------
+void BinarySnapshot::WriteAttribute (const gchar *name,
+                                     const gchar *value)
+{
+  if (_pending)
+  {
+    PutString (_attributes, name);
+    PutString (_attributes, value);
+    _attr_count++;
+  }
+}
+
+// --------------------------------------------------------------------------------
+void BinarySnapshot::WriteText (const gchar *value)
+{
+  if (_elements)
+  {
+    FlushPending ();
+
+    PutVarint (_tree, TEXT);
+    PutString (_tree, value);
+  }
+}
+
+// --------------------------------------------------------------------------------
+void BinarySnapshot::EndElement ()
+{
+  if (_elements)
+  {
+    FlushPending ();
+
+    PutVarint (_tree, END);
+    _elements--;
+  }
+}
+
+// --------------------------------------------------------------------------------
+gchar *BinarySnapshot::GetFilename (const gchar *xml_filename)
+{
+  return g_strdup_printf ("%s.snapshot", xml_filename);
+}
+
+// --------------------------------------------------------------------------------
+gboolean BinarySnapshot::GetStamp (const gchar *xml_filename,
+                                   guint64     *size,
+                                   gint64      *mtime)
+{
+  GStatBuf status;
+
+  if (g_stat (xml_filename, &status) == 0)
+  {
+    *size  = (guint64) status.st_size;
+    *mtime = (gint64)  status.st_mtime;
+
+    return TRUE;
+  }
+
+  return FALSE;
+}
+
+// --------------------------------------------------------------------------------
+GBytes *BinarySnapshot::Encode (const gchar *xml_filename)
+{
+  guint64     xml_size;
+  gint64      xml_mtime;
+  GByteArray *image;
+
+  if (   (_tree->len == 0)
+      || _elements
+      || (GetStamp (xml_filename, &xml_size, &xml_mtime) == FALSE))
+  {
+    return nullptr;
+  }
+
+  image = g_byte_array_sized_new (HEADER_SIZE + _tree->len);
+  g_byte_array_set_size (image,
+                         HEADER_SIZE);
+
+  PutVarint (image,
+             _strings->len);
+  for (guint i = 0; i < _strings->len; i++)
+  {
+    const gchar *string = (const gchar *) g_ptr_array_index (_strings, i);
+    gsize        length = strlen (string);
+
+    PutVarint (image,
+               length);
+    g_byte_array_append (image,
+                         (const guint8 *) string,
+                         length + 1);
+  }
+  g_byte_array_append (image,
+                       _tree->data,
+                       _tree->len);
+
+  {
+    guint8    *header        = image->data;
+    gsize      digest_length = 16;
+    GChecksum *checksum      = g_checksum_new (G_CHECKSUM_MD5);
+
+    memcpy (header, MAGIC, sizeof (MAGIC));
+    PutFixed (&header[8],  VERSION,                   4);
+    PutFixed (&header[12], 0,                         4);
+    PutFixed (&header[16], xml_size,                  8);
+    PutFixed (&header[24], (guint64) xml_mtime,       8);
+    PutFixed (&header[32], image->len - HEADER_SIZE,  8);
+
+    g_checksum_update (checksum,
+                       &image->data[HEADER_SIZE],
+                       image->len - HEADER_SIZE);
+    g_checksum_get_digest (checksum,
+                           &header[40],
+                           &digest_length);
+    g_checksum_free (checksum);
+  }
+
+  return g_byte_array_free_to_bytes (image);
+}
+
+// --------------------------------------------------------------------------------
+xmlDoc *BinarySnapshot::Load (const gchar *xml_filename)
+{
+  xmlDoc      *doc      = nullptr;
+  gchar       *filename = GetFilename (xml_filename);
+  GMappedFile *mapping  = nullptr;
+  guint64      xml_size;
+  gint64       xml_mtime;
+
+  if (   GetStamp (xml_filename, &xml_size, &xml_mtime)
+      && g_file_test (filename, G_FILE_TEST_IS_REGULAR))
+  {
+    mapping = g_mapped_file_new (filename,
+                                 FALSE,
+                                 nullptr);
+  }
+
+  if (mapping && (g_mapped_file_get_length (mapping) >= HEADER_SIZE))
+  {
+    const guint8 *header = (const guint8 *) g_mapped_file_get_contents (mapping);
+    gsize         length = g_mapped_file_get_length (mapping);
+
+    // Only the first page is touched to reject an out of date image.
+    // Past that point the checksum reads the whole payload once.
+    if (   (memcmp (header, MAGIC, sizeof (MAGIC)) == 0)
+        && (GetFixed (&header[8],  4) == VERSION)
+        && (GetFixed (&header[16], 8) == xml_size)
+        && (GetFixed (&header[24], 8) == (guint64) xml_mtime)
+        && (GetFixed (&header[32], 8) == length - HEADER_SIZE))
+    {
+      guint8     digest[16];
+      gsize      digest_length = sizeof (digest);
+      GChecksum *checksum      = g_checksum_new (G_CHECKSUM_MD5);
+
+      g_checksum_update (checksum,
+                         &header[HEADER_SIZE],
+                         length - HEADER_SIZE);
+      g_checksum_get_digest (checksum,
+                             digest,
+                             &digest_length);
+      g_checksum_free (checksum);
+
+      if (memcmp (digest, &header[40], sizeof (digest)) == 0)
+      {
+        Decoder decoder;
+
+        decoder._cursor       = &header[HEADER_SIZE];
+        decoder._end          = &header[length];
+        decoder._strings      = nullptr;
+        decoder._string_count = 0;
+
+        if (   GetVarint (&decoder, &decoder._string_count)
+            && (decoder._string_count <= (guint64) (decoder._end - decoder._cursor)))
+        {
+          guint64 count = 0;
+
+          decoder._strings = g_new (const gchar *, decoder._string_count);
+
+          for (; count < decoder._string_count; count++)
+          {
+            guint64 string_length;
+
+            if (   (GetVarint (&decoder, &string_length) == FALSE)
+                || (string_length >= (guint64) (decoder._end - decoder._cursor))
+                || (decoder._cursor[string_length] != '\0'))
+            {
+              break;
+            }
+
+            decoder._strings[count] = (const gchar *) decoder._cursor;
+            decoder._cursor += string_length + 1;
+          }
+
+          if (count == decoder._string_count)
+          {
+            guint64 opcode;
+
+            // Element and attribute names are interned once for all
+            decoder._doc       = xmlNewDoc (BAD_CAST "1.0");
+            decoder._doc->dict = xmlDictCreate ();
+
+            if (GetVarint (&decoder, &opcode) && (opcode == ELEMENT))
+            {
+              xmlNode *root = DecodeElement (&decoder,
+                                             0);
+
+              if (root)
+              {
+                xmlDocSetRootElement (decoder._doc,
+                                      root);
+                doc = decoder._doc;
+              }
+            }
+
+            if (doc == nullptr)
+            {
+              xmlFreeDoc (decoder._doc);
+            }
+          }
+
+          g_free (decoder._strings);
+        }
+      }
+    }
+  }
+
+  if (mapping)
+  {
+#ifdef DEBUG
+    if (doc == nullptr)
+    {
+      printf ("BinarySnapshot: %s out of date or damaged\n", filename);
+    }
+#endif
+    g_mapped_file_unref (mapping);
+  }
+
+  g_free (filename);
+
+  return doc;
+}
@@ -0,0 +1,73 @@
+// Copyright (C) 2009 Yannick Le Roux.
+// This file is part of BellePoule.
+//
+//   BellePoule is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   BellePoule is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with BellePoule.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <glib.h>
+#include <libxml/tree.h>
+
+#include "util/object.hpp"
+
+// Binary image of a saved contest document. Element names, attribute names
+// and values are gathered in a string table so that names, clubs, nations
+// and the like are stored once. The image is built while the document is
+// serialized, then stamped with the size and the modification time of the
+// XML file written from the same serialization. It is only used while that
+// file is left untouched. It is read through a memory mapping and decoded
+// into an xmlDoc: values are copied into the document, element and
+// attribute names are shared through its dictionary.
+class BinarySnapshot : public Object
+{
+  public:
+    static const guint32 VERSION = 1;
+
+    BinarySnapshot ();
+
+    void StartElement (const gchar *name);
+
+    void WriteAttribute (const gchar *name,
+                         const gchar *value);
+
+    void WriteText (const gchar *value);
+
+    void EndElement ();
+
+    GBytes *Encode (const gchar *xml_filename);
+
+    static gchar *GetFilename (const gchar *xml_filename);
+
+    static xmlDoc *Load (const gchar *xml_filename);
+
+  private:
+    GHashTable *_index;
+    GPtrArray  *_strings;
+    GByteArray *_tree;
+    GByteArray *_attributes;
+    guint       _attr_count;
+    gboolean    _pending;
+    guint       _elements;
+
+    ~BinarySnapshot () override;
+
+    void PutString (GByteArray  *array,
+                    const gchar *string);
+
+    void FlushPending ();
+
+    static gboolean GetStamp (const gchar *xml_filename,
+                              guint64     *size,
+                              gint64      *mtime);
+};
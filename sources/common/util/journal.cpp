@@ -0,0 +1,255 @@
+// Copyright (C) 2009 Yannick Le Roux.
+// This file is part of BellePoule.
+//
+//   BellePoule is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   BellePoule is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with BellePoule.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <errno.h>
+#include <string.h>
+#include <glib/gstdio.h>
+
+#ifdef G_OS_WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "network/message.hpp"
+
+#include "journal.hpp"
+
+// --------------------------------------------------------------------------------
+Journal::Journal (const gchar *path)
+  : Object ("Journal")
+{
+  _path  = g_strdup (path);
+  _file  = nullptr;
+  _count = 0;
+}
+
+// --------------------------------------------------------------------------------
+Journal::~Journal ()
+{
+  if (_file)
+  {
+    fclose (_file);
+  }
+
+  g_free (_path);
+}
+
+// --------------------------------------------------------------------------------
+gboolean Journal::Append (Net::Message *record)
+{
+  if (_file == nullptr)
+  {
+    _file = g_fopen (_path, "ab");
+
+    if (_file == nullptr)
+    {
+      g_warning ("Unable to open %s: %s", _path, g_strerror (errno));
+      return FALSE;
+    }
+
+    // Isolate a record torn by a previous crash
+    fputc ('\n', _file);
+  }
+
+  {
+    gchar    *parcel  = record->GetParcel ();
+    gchar    *line    = g_strescape (parcel, nullptr);
+    gboolean  written;
+
+    // One length prefixed record per line, made durable by Flush ()
+    written = (fprintf (_file, "%" G_GSIZE_FORMAT " %s\n", strlen (line), line) > 0);
+
+    g_free (line);
+    g_free (parcel);
+
+    if (written == FALSE)
+    {
+      g_warning ("Unable to write %s: %s", _path, g_strerror (errno));
+      return FALSE;
+    }
+  }
+
+  _count++;
+
+  return TRUE;
+}
+
+// --------------------------------------------------------------------------------
+gboolean Journal::Flush ()
+{
+  if (_file)
+  {
+    gboolean written = (fflush (_file) == 0);
+
+#ifdef G_OS_WIN32
+    written = written && (_commit (fileno (_file)) == 0);
+#else
+    written = written && (fsync (fileno (_file)) == 0);
+#endif
+
+    if (written == FALSE)
+    {
+      g_warning ("Unable to write %s: %s", _path, g_strerror (errno));
+      return FALSE;
+    }
+  }
+
+  return TRUE;
+}
+
+// --------------------------------------------------------------------------------
+GList *Journal::Read ()
+{
+  GList *records = nullptr;
+  gchar *content;
+
+  if (g_file_get_contents (_path,
+                           &content,
+                           nullptr,
+                           nullptr))
+  {
+    gchar **lines = g_strsplit (content,
+                                "\n",
+                                -1);
+
+    for (guint i = 0; lines[i]; i++)
+    {
+      const gchar *escaped = GetRecord (lines[i]);
+
+      if (escaped)
+      {
+        gchar        *parcel = g_strcompress (escaped);
+        Net::Message *record = new Net::Message ((const guint8 *) parcel);
+
+        if (record->IsValid ())
+        {
+          records = g_list_prepend (records,
+                                    record);
+        }
+        else
+        {
+          record->Release ();
+        }
+
+        g_free (parcel);
+        _count++;
+      }
+    }
+
+    g_strfreev (lines);
+    g_free (content);
+  }
+
+  return g_list_reverse (records);
+}
+
+// --------------------------------------------------------------------------------
+const gchar *Journal::GetRecord (const gchar *line)
+{
+  gchar   *escaped;
+  guint64  size = g_ascii_strtoull (line,
+                                    &escaped,
+                                    10);
+
+  // Torn records don't match their length
+  if ((escaped[0] == ' ') && (strlen (&escaped[1]) == size) && (size > 0))
+  {
+    return &escaped[1];
+  }
+
+  return nullptr;
+}
+
+// --------------------------------------------------------------------------------
+guint Journal::GetMark ()
+{
+  return _count;
+}
+
+// --------------------------------------------------------------------------------
+void Journal::Compact (guint mark)
+{
+  if (_file)
+  {
+    fclose (_file);
+    _file = nullptr;
+  }
+
+  if (mark >= _count)
+  {
+    g_unlink (_path);
+    _count = 0;
+  }
+  else if (mark > 0)
+  {
+    // Records appended after the mark are not in the snapshot yet
+    gchar *content;
+
+    if (g_file_get_contents (_path,
+                             &content,
+                             nullptr,
+                             nullptr))
+    {
+      gchar   **lines     = g_strsplit (content,
+                                        "\n",
+                                        -1);
+      GString  *kept      = g_string_new (nullptr);
+      gchar    *temp_name = g_strdup_printf ("%s.tmp", _path);
+      guint     skipped   = 0;
+
+      for (guint i = 0; lines[i]; i++)
+      {
+        if (GetRecord (lines[i]))
+        {
+          if (skipped < mark)
+          {
+            skipped++;
+          }
+          else
+          {
+            g_string_append_printf (kept, "%s\n", lines[i]);
+          }
+        }
+      }
+
+      if (g_file_set_contents (temp_name,
+                               kept->str,
+                               kept->len,
+                               nullptr))
+      {
+#ifdef G_OS_WIN32
+        // Windows refuses to rename over an existing file
+        g_unlink (_path);
+#endif
+        if (g_rename (temp_name, _path) == 0)
+        {
+          _count -= mark;
+        }
+        else
+        {
+          g_warning ("Unable to compact %s: %s", _path, g_strerror (errno));
+          g_unlink (temp_name);
+        }
+      }
+
+      g_free (temp_name);
+      g_string_free (kept, TRUE);
+      g_strfreev (lines);
+      g_free (content);
+    }
+  }
+}
@@ -787,6 +787,15 @@ void Module::MakeDirty ()
   }
 }
 
+// --------------------------------------------------------------------------------
+void Module::Journalize (Net::Message *record)
+{
+  if (_owner)
+  {
+    _owner->Journalize (record);
+  }
+}
+
 // --------------------------------------------------------------------------------
 void Module::on_begin_print (GtkPrintOperation *operation,
                              GtkPrintContext   *context,
@@ -79,6 +79,8 @@ class Module : public virtual Object
 
     virtual void MakeDirty ();
 
+    virtual void Journalize (Net::Message *record);
+
     virtual void DrawContainerPage (GtkPrintOperation *operation,
                                     GtkPrintContext   *context,
                                     gint               page_nr);
@@ -597,98 +597,101 @@ void Player::Save (XmlScheme *xml_scheme,
 // --------------------------------------------------------------------------------
 void Player::Load (xmlNode *xml_node)
 {
-  GSList      *attr_list;
   AttributeId attending_attr_id ("attending");
 
-  AttributeDesc::CreateExcludingList (&attr_list,
-                                      NULL);
-
-  for (GSList *current = attr_list; current; current = g_slist_next (current))
+  // One pass over the properties actually present in the node rather than
+  // one xmlGetProp lookup per declared attribute.
+  for (xmlAttr *prop = xml_node->properties; prop; prop = prop->next)
   {
-    AttributeDesc *desc = (AttributeDesc *) current->data;
+    GSList *homonyms = AttributeDesc::GetDescListFromXmlName ((const gchar *) prop->name);
 
-    if (desc->_computability == AttributeDesc::Computability::NOT_COMPUTABLE)
+    for (GSList *current = homonyms; current; current = g_slist_next (current))
     {
-      gchar *value = (gchar *) xmlGetProp (xml_node, BAD_CAST desc->_xml_name);
+      AttributeDesc *desc = (AttributeDesc *) current->data;
 
-      if (value)
+      if (desc->_computability == AttributeDesc::Computability::NOT_COMPUTABLE)
       {
-        AttributeId attr_id (desc->_code_name);
+        gchar *value = (gchar *) xmlNodeGetContent ((xmlNode *) prop);
 
-        SetAttributeValue (&attr_id,
-                           value);
-
-        if (g_strcmp0 (desc->_code_name, "ref") == 0)
+        if (value)
         {
-          Attribute *attr = GetAttribute (&attr_id);
+          AttributeId attr_id (desc->_code_name);
+
+          SetAttributeValue (&attr_id,
+                             value);
 
-          if (attr)
+          if (g_strcmp0 (desc->_code_name, "ref") == 0)
           {
-            _ref = attr->GetUIntValue ();
-          }
-        }
+            Attribute *attr = GetAttribute (&attr_id);
 
-        if (g_strcmp0 (desc->_code_name, "birth_date") == 0)
-        {
-          Attribute *attr = GetAttribute (&attr_id);
+            if (attr)
+            {
+              _ref = attr->GetUIntValue ();
+            }
+          }
 
-          if (attr)
+          if (g_strcmp0 (desc->_code_name, "birth_date") == 0)
           {
-            gchar *french_date = attr->GetStrValue ();
-            gchar **splitted_date;
-
-            splitted_date = g_strsplit_set (french_date,
-                                            ".",
-                                            0);
-            if (   splitted_date
-                && splitted_date[0]
-                && splitted_date[1]
-                && splitted_date[2])
-            {
-              gchar buffer[50];
+            Attribute *attr = GetAttribute (&attr_id);
 
-              if (   (g_ascii_strcasecmp (splitted_date[0], "00") == 0)
-                  || (g_ascii_strcasecmp (splitted_date[1], "00") == 0))
-              {
-                // AskFred
-                g_strlcpy (buffer,
-                           splitted_date[2],
-                           sizeof (buffer));
-              }
-              else
+            if (attr)
+            {
+              gchar *french_date = attr->GetStrValue ();
+              gchar **splitted_date;
+
+              splitted_date = g_strsplit_set (french_date,
+                                              ".",
+                                              0);
+              if (   splitted_date
+                  && splitted_date[0]
+                  && splitted_date[1]
+                  && splitted_date[2])
               {
-                GDate *date = g_date_new ();
-
-                g_date_set_day   (date, (GDateDay)   atoi (splitted_date[0]));
-                g_date_set_month (date, (GDateMonth) atoi (splitted_date[1]));
-                g_date_set_year  (date, (GDateYear)  atoi (splitted_date[2]));
-
-                g_date_strftime (buffer,
-                                 sizeof (buffer),
-                                 "%x",
-                                 date);
-                g_date_free (date);
+                gchar buffer[50];
+
+                if (   (g_ascii_strcasecmp (splitted_date[0], "00") == 0)
+                    || (g_ascii_strcasecmp (splitted_date[1], "00") == 0))
+                {
+                  // AskFred
+                  g_strlcpy (buffer,
+                             splitted_date[2],
+                             sizeof (buffer));
+                }
+                else
+                {
+                  GDate *date = g_date_new ();
+
+                  g_date_set_day   (date, (GDateDay)   atoi (splitted_date[0]));
+                  g_date_set_month (date, (GDateMonth) atoi (splitted_date[1]));
+                  g_date_set_year  (date, (GDateYear)  atoi (splitted_date[2]));
+
+                  g_date_strftime (buffer,
+                                   sizeof (buffer),
+                                   "%x",
+                                   date);
+                  g_date_free (date);
+                }
+                attr->SetValue (buffer);
               }
-              attr->SetValue (buffer);
+              g_strfreev (splitted_date);
             }
-            g_strfreev (splitted_date);
           }
-        }
 
-        if (g_strcmp0 (desc->_code_name, "global_status") == 0)
-        {
-          if (value[0] == 'F')
-          {
-            SetAttributeValue (&attending_attr_id,
-                               (guint) FALSE);
-          }
-          else
+          if (g_strcmp0 (desc->_code_name, "global_status") == 0)
           {
-            SetAttributeValue (&attending_attr_id,
-                               TRUE);
+            if (value[0] == 'F')
+            {
+              SetAttributeValue (&attending_attr_id,
+                                 (guint) FALSE);
+            }
+            else
+            {
+              SetAttributeValue (&attending_attr_id,
+                                 TRUE);
+            }
           }
+          xmlFree (value);
         }
-        xmlFree (value);
       }
     }
   }
@@ -698,8 +701,6 @@ void Player::Load (xmlNode *xml_node)
     SetAttributeValue (&attending_attr_id,
                        (guint) FALSE);
   }
-
-  g_slist_free (attr_list);
 }
 
 // --------------------------------------------------------------------------------
@@ -0,0 +1,286 @@
+// Copyright (C) 2009 Yannick Le Roux.
+// This file is part of BellePoule.
+//
+//   BellePoule is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   BellePoule is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with BellePoule.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <errno.h>
+#include <stdio.h>
+#include <glib/gstdio.h>
+
+#ifdef G_OS_WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "binary_snapshot.hpp"
+#include "snapshot_writer.hpp"
+
+// --------------------------------------------------------------------------------
+SnapshotWriter::SnapshotWriter (Listener  *listener,
+                                xmlBuffer *snapshot)
+  : Object ("SnapshotWriter")
+{
+  _listener        = listener;
+  _destinations    = nullptr;
+  _thread          = nullptr;
+  _primary_written = FALSE;
+  _binary_snapshot = nullptr;
+
+  // Shared as is with the uploaders
+  {
+    gsize    length  = xmlBufferLength (snapshot);
+    xmlChar *content = xmlBufferDetach (snapshot);
+
+    _snapshot = g_bytes_new_with_free_func (content,
+                                            length,
+                                            (GDestroyNotify) xmlFree,
+                                            content);
+    xmlBufferFree (snapshot);
+  }
+}
+
+// --------------------------------------------------------------------------------
+SnapshotWriter::~SnapshotWriter ()
+{
+  g_list_free_full (_destinations,
+                    g_free);
+
+  g_bytes_unref (_snapshot);
+
+  Object::TryToRelease (_binary_snapshot);
+}
+
+// --------------------------------------------------------------------------------
+void SnapshotWriter::AddDestination (const gchar *filename)
+{
+  _destinations = g_list_append (_destinations,
+                                 g_strdup (filename));
+}
+
+// --------------------------------------------------------------------------------
+void SnapshotWriter::EnableBinarySnapshot (BinarySnapshot *binary_snapshot)
+{
+  // Filled in along with the XML serialization, only stamped here
+  _binary_snapshot = binary_snapshot;
+  _binary_snapshot->Retain ();
+}
+
+// --------------------------------------------------------------------------------
+void SnapshotWriter::Start ()
+{
+  GError *error = nullptr;
+
+  Retain ();
+
+  _thread = g_thread_try_new ("SnapshotWriter",
+                              (GThreadFunc) ThreadFunction,
+                              this,
+                              &error);
+
+  if (_thread == nullptr)
+  {
+    g_printerr ("Failed to create SnapshotWriter thread: %s\n", error->message);
+    g_error_free (error);
+
+    ThreadFunction (this);
+  }
+}
+
+// --------------------------------------------------------------------------------
+void SnapshotWriter::Join ()
+{
+  if (_thread)
+  {
+    g_thread_join (_thread);
+    _thread = nullptr;
+  }
+}
+
+// --------------------------------------------------------------------------------
+void SnapshotWriter::Detach ()
+{
+  _listener = nullptr;
+}
+
+// --------------------------------------------------------------------------------
+gboolean SnapshotWriter::PrimaryWritten ()
+{
+  return _primary_written;
+}
+
+// --------------------------------------------------------------------------------
+GBytes *SnapshotWriter::GetSnapshot ()
+{
+  return _snapshot;
+}
+
+// --------------------------------------------------------------------------------
+gboolean SnapshotWriter::WriteFile (const gchar *filename,
+                                    GBytes      *snapshot)
+{
+  gsize         length;
+  const guint8 *data      = (const guint8 *) g_bytes_get_data (snapshot, &length);
+  gchar        *temp_name = g_strdup_printf ("%s.tmp", filename);
+  FILE         *file      = g_fopen (temp_name, "wb");
+  gboolean      written   = FALSE;
+  int           error     = 0;
+
+  if (file)
+  {
+    written = (fwrite (data, 1, length, file) == length) && (fflush (file) == 0);
+
+#ifdef G_OS_WIN32
+    written = written && (_commit (fileno (file)) == 0);
+#else
+    written = written && (fsync (fileno (file)) == 0);
+#endif
+
+    if (written == FALSE)
+    {
+      error = errno;
+    }
+
+    if ((fclose (file) != 0) && written)
+    {
+      error   = errno;
+      written = FALSE;
+    }
+
+    // The previous version stays in place until the new one is complete
+    if (written && (g_rename (temp_name, filename) != 0))
+    {
+#ifdef G_OS_WIN32
+      // Windows refuses to rename over an existing file
+      g_unlink (filename);
+      written = (g_rename (temp_name, filename) == 0);
+#else
+      written = FALSE;
+#endif
+      if (written == FALSE)
+      {
+        error = errno;
+      }
+    }
+  }
+  else
+  {
+    error = errno;
+  }
+
+  if (written == FALSE)
+  {
+    g_warning ("Unable to save %s: %s", filename, g_strerror (error));
+    g_unlink (temp_name);
+  }
+
+  g_free (temp_name);
+
+  return written;
+}
+
+// --------------------------------------------------------------------------------
+void SnapshotWriter::WriteBinarySnapshot (const gchar *primary)
+{
+  if (_binary_snapshot)
+  {
+#ifdef DEBUG
+    gint64  start = g_get_monotonic_time ();
+#endif
+    GBytes *image = _binary_snapshot->Encode (primary);
+
+    if (image)
+    {
+      gchar *filename = BinarySnapshot::GetFilename (primary);
+
+      WriteFile (filename,
+                 image);
+
+#ifdef DEBUG
+      printf ("SnapshotWriter: %" G_GSIZE_FORMAT " bytes in %" G_GINT64_FORMAT " us >> %s\n",
+              g_bytes_get_size (image),
+              g_get_monotonic_time () - start,
+              filename);
+#endif
+
+      g_free (filename);
+      g_bytes_unref (image);
+    }
+  }
+}
+
+// --------------------------------------------------------------------------------
+gpointer SnapshotWriter::ThreadFunction (SnapshotWriter *writer)
+{
+  // A binary image older than the primary file must not survive
+  // an interrupted save.
+  if (writer->_destinations)
+  {
+    gchar *companion = BinarySnapshot::GetFilename ((const gchar *) writer->_destinations->data);
+
+    g_unlink (companion);
+    g_free (companion);
+  }
+
+  for (GList *current = writer->_destinations; current; current = g_list_next (current))
+  {
+    const gchar *filename = (const gchar *) current->data;
+#ifdef DEBUG
+    gint64       start    = g_get_monotonic_time ();
+#endif
+    gboolean     written  = WriteFile (filename,
+                                       writer->_snapshot);
+
+#ifdef DEBUG
+    printf ("SnapshotWriter: %" G_GSIZE_FORMAT " bytes in %" G_GINT64_FORMAT " us >> %s\n",
+            g_bytes_get_size (writer->_snapshot),
+            g_get_monotonic_time () - start,
+            filename);
+#endif
+
+    if (current == writer->_destinations)
+    {
+      writer->_primary_written = written;
+
+      if (written)
+      {
+        writer->WriteBinarySnapshot (filename);
+      }
+    }
+  }
+
+  g_idle_add ((GSourceFunc) OnThreadDone,
+              writer);
+
+  return nullptr;
+}
+
+// --------------------------------------------------------------------------------
+gboolean SnapshotWriter::OnThreadDone (SnapshotWriter *writer)
+{
+  if (writer->_thread)
+  {
+    g_thread_unref (writer->_thread);
+    writer->_thread = nullptr;
+  }
+
+  if (writer->_listener)
+  {
+    writer->_listener->OnSnapshotWritten (writer);
+  }
+
+  writer->Release ();
+
+  return G_SOURCE_REMOVE;
+}
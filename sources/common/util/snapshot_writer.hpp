@@ -0,0 +1,69 @@
+// Copyright (C) 2009 Yannick Le Roux.
+// This file is part of BellePoule.
+//
+//   BellePoule is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   BellePoule is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with BellePoule.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <libxml/tree.h>
+
+#include "util/object.hpp"
+
+class BinarySnapshot;
+
+class SnapshotWriter : public Object
+{
+  public:
+    struct Listener
+    {
+      virtual void OnSnapshotWritten (SnapshotWriter *writer) = 0;
+    };
+
+  public:
+    SnapshotWriter (Listener  *listener,
+                    xmlBuffer *snapshot);
+
+    void AddDestination (const gchar *filename);
+
+    void EnableBinarySnapshot (BinarySnapshot *binary_snapshot);
+
+    void Start ();
+
+    void Join ();
+
+    void Detach ();
+
+    gboolean PrimaryWritten ();
+
+    GBytes *GetSnapshot ();
+
+  private:
+    Listener       *_listener;
+    GBytes         *_snapshot;
+    GList          *_destinations;
+    GThread        *_thread;
+    gboolean        _primary_written;
+    BinarySnapshot *_binary_snapshot;
+
+    ~SnapshotWriter () override;
+
+    static gboolean WriteFile (const gchar *filename,
+                               GBytes      *snapshot);
+
+    void WriteBinarySnapshot (const gchar *primary);
+
+    static gpointer ThreadFunction (SnapshotWriter *writer);
+
+    static gboolean OnThreadDone (SnapshotWriter *writer);
+};
@@ -16,13 +16,16 @@
 
 #include <libxml/xmlwriter.h>
 
+#include "binary_snapshot.hpp"
 #include "xml_scheme.hpp"
 
 // --------------------------------------------------------------------------------
 XmlScheme::XmlScheme (const gchar *filename)
   : Object ("XmlScheme")
 {
-  _elements = nullptr;
+  _elements        = nullptr;
+  _binary_snapshot = nullptr;
+  _hidden          = 0;
 
   _xml_writer = xmlNewTextWriterFilename (filename,
                                           0);
@@ -35,15 +38,26 @@ XmlScheme::XmlScheme (const gchar *filename)
 }
 
 // --------------------------------------------------------------------------------
-XmlScheme::XmlScheme (xmlBuffer *xml_buffer)
+XmlScheme::XmlScheme (xmlBuffer *xml_buffer,
+                      gboolean   as_document)
   : Object ("XmlScheme")
 {
-  _elements = nullptr;
+  _elements        = nullptr;
+  _binary_snapshot = nullptr;
+  _hidden          = 0;
 
   _xml_writer = xmlNewTextWriterMemory (xml_buffer,
                                         0);
   xmlTextWriterSetIndent (_xml_writer,
-                          FALSE);
+                          as_document);
+
+  if (as_document)
+  {
+    xmlTextWriterStartDocument (_xml_writer,
+                                nullptr,
+                                "UTF-8",
+                                nullptr);
+  }
 }
 
 // --------------------------------------------------------------------------------
@@ -54,6 +68,20 @@ XmlScheme::~XmlScheme ()
     xmlTextWriterEndDocument (_xml_writer);
     xmlFreeTextWriter (_xml_writer);
   }
+
+  Object::TryToRelease (_binary_snapshot);
+}
+
+// --------------------------------------------------------------------------------
+void XmlScheme::SetBinarySnapshot (BinarySnapshot *binary_snapshot)
+{
+  Object::TryToRelease (_binary_snapshot);
+
+  _binary_snapshot = binary_snapshot;
+  if (_binary_snapshot)
+  {
+    _binary_snapshot->Retain ();
+  }
 }
 
 // --------------------------------------------------------------------------------
@@ -71,12 +99,14 @@ const gchar *XmlScheme::GetCurrentElement ()
 void XmlScheme::StartComment ()
 {
   xmlTextWriterStartComment (_xml_writer);
+  _hidden++;
 }
 
 // --------------------------------------------------------------------------------
 void XmlScheme::EndComment ()
 {
   xmlTextWriterEndComment (_xml_writer);
+  _hidden--;
 }
 
 // --------------------------------------------------------------------------------
@@ -86,12 +116,14 @@ void XmlScheme::StartDTD (const gchar *name)
                          BAD_CAST name,
                          nullptr,
                          nullptr);
+  _hidden++;
 }
 
 // --------------------------------------------------------------------------------
 void XmlScheme::EndDTD ()
 {
   xmlTextWriterEndDTD (_xml_writer);
+  _hidden--;
 }
 
 // --------------------------------------------------------------------------------
@@ -104,6 +136,11 @@ void XmlScheme::StartElement (const gchar *element)
   {
     xmlTextWriterStartElement (_xml_writer,
                                BAD_CAST Translate (element));
+
+    if (_binary_snapshot)
+    {
+      _binary_snapshot->StartElement (Translate (element));
+    }
   }
 }
 
@@ -113,6 +150,11 @@ void XmlScheme::EndElement ()
   if (CurrentElementIsVisible ())
   {
     xmlTextWriterEndElement (_xml_writer);
+
+    if (_binary_snapshot)
+    {
+      _binary_snapshot->EndElement ();
+    }
   }
 
   _elements = g_list_delete_link (_elements,
@@ -144,6 +186,12 @@ void XmlScheme::WriteAttribute (const gchar *attribute,
       xmlTextWriterWriteAttribute (_xml_writer,
                                    BAD_CAST Translate (attribute),
                                    BAD_CAST translated_value);
+
+      if (_binary_snapshot)
+      {
+        _binary_snapshot->WriteAttribute (Translate (attribute),
+                                          translated_value);
+      }
     }
   }
 }
@@ -166,6 +214,21 @@ void XmlScheme::WriteFormatAttribute (const gchar *attribute,
 
       if (translated_value)
       {
+        if (_binary_snapshot)
+        {
+          va_list  vargs_binary;
+          gchar   *value;
+
+          va_copy (vargs_binary, vargs);
+          value = g_strdup_vprintf (translated_value,
+                                    vargs_binary);
+          va_end (vargs_binary);
+
+          _binary_snapshot->WriteAttribute (Translate (attribute),
+                                            value);
+          g_free (value);
+        }
+
         xmlTextWriterWriteVFormatAttribute (_xml_writer,
                                             BAD_CAST Translate (attribute),
                                             translated_value,
@@ -193,6 +256,22 @@ void XmlScheme::WriteFormatString (const gchar *format_string,
   va_list vargs;
 
   va_start (vargs, format_string);
+
+  // Comments and DTD are not part of the binary image
+  if (_binary_snapshot && (_hidden == 0))
+  {
+    va_list  vargs_binary;
+    gchar   *text;
+
+    va_copy (vargs_binary, vargs);
+    text = g_strdup_vprintf (format_string,
+                             vargs_binary);
+    va_end (vargs_binary);
+
+    _binary_snapshot->WriteText (text);
+    g_free (text);
+  }
+
   xmlTextWriterWriteVFormatString (_xml_writer,
                                    format_string,
                                    vargs);
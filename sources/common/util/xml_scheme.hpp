@@ -21,15 +21,20 @@
 
 #include "util/object.hpp"
 
+class BinarySnapshot;
+
 class XmlScheme : public virtual Object
 {
   public:
     XmlScheme (const gchar *filename);
 
-    XmlScheme (xmlBuffer *xml_buffer);
+    XmlScheme (xmlBuffer *xml_buffer,
+               gboolean   as_document = FALSE);
 
     virtual gboolean SaveFencersAndTeamsSeparatly ();
 
+    void SetBinarySnapshot (BinarySnapshot *binary_snapshot);
+
   public:
     void StartComment ();
     void EndComment ();
@@ -56,8 +61,10 @@ class XmlScheme : public virtual Object
     ~XmlScheme () override;
 
   private:
-    xmlTextWriter *_xml_writer;
-    GList         *_elements;
+    xmlTextWriter  *_xml_writer;
+    GList          *_elements;
+    BinarySnapshot *_binary_snapshot;
+    guint           _hidden;
 
     const gchar *GetCurrentElement ();
 